@@ -0,0 +1,442 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66InputLatency.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "T66.h"
+
+CSV_DEFINE_CATEGORY(T66InputLatency, true);
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Combo Attack Last (ms)"), STAT_T66InputLatency_ComboAttack_Last, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Combo Attack Avg (ms)"), STAT_T66InputLatency_ComboAttack_Avg, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Combo Attack P95 (ms)"), STAT_T66InputLatency_ComboAttack_P95, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Combo Attack Max (ms)"), STAT_T66InputLatency_ComboAttack_Max, STATGROUP_T66InputLatency);
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Charged Attack Last (ms)"), STAT_T66InputLatency_ChargedAttack_Last, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Charged Attack Avg (ms)"), STAT_T66InputLatency_ChargedAttack_Avg, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Charged Attack P95 (ms)"), STAT_T66InputLatency_ChargedAttack_P95, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Charged Attack Max (ms)"), STAT_T66InputLatency_ChargedAttack_Max, STATGROUP_T66InputLatency);
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Jump Last (ms)"), STAT_T66InputLatency_Jump_Last, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Jump Avg (ms)"), STAT_T66InputLatency_Jump_Avg, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Jump P95 (ms)"), STAT_T66InputLatency_Jump_P95, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Jump Max (ms)"), STAT_T66InputLatency_Jump_Max, STATGROUP_T66InputLatency);
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Dash Last (ms)"), STAT_T66InputLatency_Dash_Last, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Dash Avg (ms)"), STAT_T66InputLatency_Dash_Avg, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Dash P95 (ms)"), STAT_T66InputLatency_Dash_P95, STATGROUP_T66InputLatency);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Dash Max (ms)"), STAT_T66InputLatency_Dash_Max, STATGROUP_T66InputLatency);
+
+bool FT66InputLatency::bEnabled = false;
+
+namespace T66InputLatency
+{
+	/** Width of each histogram bucket */
+	constexpr double BucketWidthMs = 5.0;
+
+	/** Number of histogram buckets. The last bucket collects every sample above the range */
+	constexpr int32 NumBuckets = 41;
+
+	/** Samples that haven't completed within this time are discarded (e.g. rejected jumps) */
+	constexpr double SampleTimeoutSeconds = 1.0;
+
+	/** Input arrivals older than this are considered stale and won't open a sample */
+	constexpr double MaxArrivalAgeSeconds = 0.25;
+
+	/** Display names, indexed by action */
+	const TCHAR* ActionNames[] = { TEXT("ComboAttack"), TEXT("ChargedAttack"), TEXT("Jump"), TEXT("Dash") };
+	static_assert(UE_ARRAY_COUNT(ActionNames) == (int32)ET66InputLatencyAction::Num, "Action names out of sync with ET66InputLatencyAction");
+
+	/** Fixed-bucket latency histogram for a single action */
+	struct FHistogram
+	{
+		uint32 Buckets[NumBuckets] = {};
+		uint32 NumSamples = 0;
+		uint64 SumFrames = 0;
+		double SumMs = 0.0;
+		double MinMs = TNumericLimits<double>::Max();
+		double MaxMs = 0.0;
+		double LastMs = 0.0;
+
+		void AddSample(double Ms, uint32 Frames)
+		{
+			const int32 Bucket = FMath::Clamp(FMath::FloorToInt32(Ms / BucketWidthMs), 0, NumBuckets - 1);
+			++Buckets[Bucket];
+			++NumSamples;
+			SumFrames += Frames;
+			SumMs += Ms;
+			MinMs = FMath::Min(MinMs, Ms);
+			MaxMs = FMath::Max(MaxMs, Ms);
+			LastMs = Ms;
+		}
+
+		double GetAverageMs() const
+		{
+			return NumSamples > 0 ? SumMs / NumSamples : 0.0;
+		}
+
+		double GetAverageFrames() const
+		{
+			return NumSamples > 0 ? double(SumFrames) / NumSamples : 0.0;
+		}
+
+		/** Returns the upper edge of the bucket containing the requested percentile */
+		double GetPercentileMs(double Percentile) const
+		{
+			if (NumSamples == 0)
+			{
+				return 0.0;
+			}
+
+			const uint32 Target = FMath::Max<uint32>(1, FMath::CeilToInt32(Percentile * NumSamples));
+			uint32 Accumulated = 0;
+
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				Accumulated += Buckets[Bucket];
+
+				if (Accumulated >= Target)
+				{
+					// the overflow bucket has no upper edge, so report the max instead
+					return Bucket == NumBuckets - 1 ? MaxMs : (Bucket + 1) * BucketWidthMs;
+				}
+			}
+
+			return MaxMs;
+		}
+	};
+
+	/** A latency sample waiting for its action to become visible */
+	struct FPendingSample
+	{
+		TWeakObjectPtr<ACharacter> Character;
+		TWeakObjectPtr<const UAnimMontage> Montage;
+		FVector StartVelocity = FVector::ZeroVector;
+		int32 StartJumpCount = 0;
+		TEnumAsByte<EMovementMode> StartMovementMode = MOVE_None;
+		uint8 StartCustomMovementMode = 0;
+		uint64 ArrivalCycles = 0;
+		uint64 StartFrame = 0;
+		ET66InputLatencyAction Action = ET66InputLatencyAction::Num;
+	};
+
+	/** Latest key press timestamp for each local player */
+	struct FArrival
+	{
+		TWeakObjectPtr<const APlayerController> PlayerController;
+		uint64 Cycles = 0;
+		uint64 Frame = 0;
+	};
+
+	FHistogram Histograms[(int32)ET66InputLatencyAction::Num];
+	TArray<FPendingSample> PendingSamples;
+	TArray<FArrival> Arrivals;
+	FDelegateHandle PostActorTickHandle;
+
+	/** Pushes the histogram summary for an action into the stat group */
+	void UpdateStats(ET66InputLatencyAction Action, const FHistogram& Histogram)
+	{
+#if STATS
+		static const FName StatNames[][4] =
+		{
+			{ GET_STATFNAME(STAT_T66InputLatency_ComboAttack_Last), GET_STATFNAME(STAT_T66InputLatency_ComboAttack_Avg), GET_STATFNAME(STAT_T66InputLatency_ComboAttack_P95), GET_STATFNAME(STAT_T66InputLatency_ComboAttack_Max) },
+			{ GET_STATFNAME(STAT_T66InputLatency_ChargedAttack_Last), GET_STATFNAME(STAT_T66InputLatency_ChargedAttack_Avg), GET_STATFNAME(STAT_T66InputLatency_ChargedAttack_P95), GET_STATFNAME(STAT_T66InputLatency_ChargedAttack_Max) },
+			{ GET_STATFNAME(STAT_T66InputLatency_Jump_Last), GET_STATFNAME(STAT_T66InputLatency_Jump_Avg), GET_STATFNAME(STAT_T66InputLatency_Jump_P95), GET_STATFNAME(STAT_T66InputLatency_Jump_Max) },
+			{ GET_STATFNAME(STAT_T66InputLatency_Dash_Last), GET_STATFNAME(STAT_T66InputLatency_Dash_Avg), GET_STATFNAME(STAT_T66InputLatency_Dash_P95), GET_STATFNAME(STAT_T66InputLatency_Dash_Max) },
+		};
+
+		const FName* Names = StatNames[(int32)Action];
+
+		SET_FLOAT_STAT_FName(Names[0], Histogram.LastMs);
+		SET_FLOAT_STAT_FName(Names[1], Histogram.GetAverageMs());
+		SET_FLOAT_STAT_FName(Names[2], Histogram.GetPercentileMs(0.95));
+		SET_FLOAT_STAT_FName(Names[3], Histogram.MaxMs);
+#endif
+	}
+
+	/** Records a completed sample */
+	void CompleteSample(const FPendingSample& Sample, uint64 NowCycles)
+	{
+		const double Ms = FPlatformTime::ToMilliseconds64(NowCycles - Sample.ArrivalCycles);
+		const uint32 Frames = uint32(GFrameCounter - Sample.StartFrame);
+
+		FHistogram& Histogram = Histograms[(int32)Sample.Action];
+		Histogram.AddSample(Ms, Frames);
+
+		UpdateStats(Sample.Action, Histogram);
+
+#if CSV_PROFILER
+		FCsvProfiler::RecordCustomStat(ActionNames[(int32)Sample.Action], CSV_CATEGORY_INDEX(T66InputLatency), float(Ms), ECsvCustomStatOp::Set);
+#endif
+	}
+
+	/** Returns true once the action started by the sample is visible */
+	bool HasActionStarted(const FPendingSample& Sample, const ACharacter* Character)
+	{
+		// montage actions complete on the first frame the montage has advanced
+		if (const UAnimMontage* Montage = Sample.Montage.Get())
+		{
+			const UAnimInstance* AnimInstance = Character->GetMesh() ? Character->GetMesh()->GetAnimInstance() : nullptr;
+
+			return AnimInstance && AnimInstance->Montage_IsPlaying(Montage) && AnimInstance->Montage_GetPosition(Montage) > 0.0f;
+		}
+
+		const UCharacterMovementComponent* Movement = Character->GetCharacterMovement();
+
+		if (!Movement)
+		{
+			return false;
+		}
+
+		switch (Sample.Action)
+		{
+		case ET66InputLatencyAction::Jump:
+
+			// jumps complete once the jump count goes up, or on the upward impulse of jumps that don't count (wall jumps).
+			// Walking or falling alone changes the velocity too, so that can't be used
+			return Character->JumpCurrentCount != Sample.StartJumpCount
+				|| Movement->Velocity.Z - Sample.StartVelocity.Z > Movement->JumpZVelocity * 0.5f;
+
+		case ET66InputLatencyAction::Dash:
+
+			// dashes without a montage complete once the dash movement mode is entered
+			return Movement->MovementMode != Sample.StartMovementMode || Movement->CustomMovementMode != Sample.StartCustomMovementMode;
+
+		default:
+			return false;
+		}
+	}
+
+	/** Checks pending samples after all actors (and their movement and animation) have ticked */
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (PendingSamples.IsEmpty())
+		{
+			return;
+		}
+
+		const uint64 NowCycles = FPlatformTime::Cycles64();
+
+		for (int32 Index = PendingSamples.Num() - 1; Index >= 0; --Index)
+		{
+			const FPendingSample& Sample = PendingSamples[Index];
+			const ACharacter* Character = Sample.Character.Get();
+
+			// drop samples whose character went away or whose action never became visible
+			if (!Character || FPlatformTime::ToSeconds64(NowCycles - Sample.ArrivalCycles) > SampleTimeoutSeconds)
+			{
+				PendingSamples.RemoveAtSwap(Index, EAllowShrinking::No);
+				continue;
+			}
+
+			// only process samples that belong to the ticking world
+			if (Character->GetWorld() != World)
+			{
+				continue;
+			}
+
+			if (HasActionStarted(Sample, Character))
+			{
+				CompleteSample(Sample, NowCycles);
+				PendingSamples.RemoveAtSwap(Index, EAllowShrinking::No);
+			}
+		}
+	}
+}
+
+void FT66InputLatency::RecordInputArrival(const APlayerController* PlayerController)
+{
+	using namespace T66InputLatency;
+
+	// only keep the latest press per player
+	for (FArrival& Arrival : Arrivals)
+	{
+		if (Arrival.PlayerController == PlayerController)
+		{
+			// keep the first press of the frame, since that's the one that waited the longest
+			if (Arrival.Frame != GFrameCounter || Arrival.Cycles == 0)
+			{
+				Arrival.Cycles = FPlatformTime::Cycles64();
+				Arrival.Frame = GFrameCounter;
+			}
+			return;
+		}
+	}
+
+	Arrivals.RemoveAllSwap([](const FArrival& Arrival) { return !Arrival.PlayerController.IsValid(); });
+
+	FArrival& NewArrival = Arrivals.AddDefaulted_GetRef();
+	NewArrival.PlayerController = PlayerController;
+	NewArrival.Cycles = FPlatformTime::Cycles64();
+	NewArrival.Frame = GFrameCounter;
+}
+
+void FT66InputLatency::OpenSample(ET66InputLatencyAction Action, ACharacter* Character, const UAnimMontage* Montage)
+{
+	using namespace T66InputLatency;
+
+	if (!Character)
+	{
+		return;
+	}
+
+	// find the input arrival for the controlling player. Actions triggered from UI or AI have none
+	const APlayerController* PlayerController = Cast<APlayerController>(Character->GetController());
+
+	FArrival* Arrival = Arrivals.FindByPredicate([PlayerController](const FArrival& Candidate) { return Candidate.PlayerController == PlayerController; });
+
+	if (!Arrival || Arrival->Cycles == 0)
+	{
+		return;
+	}
+
+	const uint64 ArrivalCycles = Arrival->Cycles;
+	const uint64 ArrivalFrame = Arrival->Frame;
+
+	// consume the arrival so a single press can't open several samples
+	Arrival->Cycles = 0;
+
+	if (FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - ArrivalCycles) > MaxArrivalAgeSeconds)
+	{
+		return;
+	}
+
+	// lazily hook the post actor tick so there's no cost until the instrumentation is used
+	if (!PostActorTickHandle.IsValid())
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&T66InputLatency::OnWorldPostActorTick);
+	}
+
+	FPendingSample& Sample = PendingSamples.AddDefaulted_GetRef();
+	Sample.Character = Character;
+	Sample.Montage = Montage;
+	Sample.StartVelocity = Character->GetVelocity();
+	Sample.StartJumpCount = Character->JumpCurrentCount;
+
+	if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+	{
+		Sample.StartMovementMode = Movement->MovementMode;
+		Sample.StartCustomMovementMode = Movement->CustomMovementMode;
+	}
+	Sample.ArrivalCycles = ArrivalCycles;
+	Sample.StartFrame = ArrivalFrame;
+	Sample.Action = Action;
+}
+
+void FT66InputLatency::DumpCSV()
+{
+	using namespace T66InputLatency;
+
+	TStringBuilder<4096> Csv;
+
+	// header
+	Csv << TEXT("Action,Samples,AvgMs,MinMs,P50Ms,P95Ms,P99Ms,MaxMs,AvgFrames");
+
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		if (Bucket == NumBuckets - 1)
+		{
+			Csv.Appendf(TEXT(",%d+ms"), FMath::RoundToInt32(Bucket * BucketWidthMs));
+		}
+		else
+		{
+			Csv.Appendf(TEXT(",%d-%dms"), FMath::RoundToInt32(Bucket * BucketWidthMs), FMath::RoundToInt32((Bucket + 1) * BucketWidthMs));
+		}
+	}
+
+	Csv << LINE_TERMINATOR;
+
+	// one row per action
+	for (int32 ActionIndex = 0; ActionIndex < (int32)ET66InputLatencyAction::Num; ++ActionIndex)
+	{
+		const FHistogram& Histogram = Histograms[ActionIndex];
+
+		Csv.Appendf(TEXT("%s,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f"),
+			ActionNames[ActionIndex],
+			Histogram.NumSamples,
+			Histogram.GetAverageMs(),
+			Histogram.NumSamples > 0 ? Histogram.MinMs : 0.0,
+			Histogram.GetPercentileMs(0.5),
+			Histogram.GetPercentileMs(0.95),
+			Histogram.GetPercentileMs(0.99),
+			Histogram.MaxMs,
+			Histogram.GetAverageFrames());
+
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			Csv.Appendf(TEXT(",%u"), Histogram.Buckets[Bucket]);
+		}
+
+		Csv << LINE_TERMINATOR;
+	}
+
+	const FString FilePath = FPaths::ProfilingDir() / TEXT("T66") / FString::Printf(TEXT("InputLatency-%s.csv"), *FDateTime::Now().ToString());
+
+	if (FFileHelper::SaveStringToFile(Csv.ToView(), *FilePath))
+	{
+		UE_LOG(LogT66, Display, TEXT("Input latency histograms written to %s"), *FilePath);
+	}
+	else
+	{
+		UE_LOG(LogT66, Error, TEXT("Could not write input latency histograms to %s"), *FilePath);
+	}
+}
+
+void FT66InputLatency::Reset()
+{
+	using namespace T66InputLatency;
+
+	for (int32 ActionIndex = 0; ActionIndex < (int32)ET66InputLatencyAction::Num; ++ActionIndex)
+	{
+		Histograms[ActionIndex] = FHistogram();
+		UpdateStats((ET66InputLatencyAction)ActionIndex, Histograms[ActionIndex]);
+	}
+
+	PendingSamples.Reset();
+	Arrivals.Reset();
+}
+
+/** Console bindings for the input latency instrumentation */
+struct FT66InputLatencyConsole
+{
+	static void OnEnableChanged(IConsoleVariable* Variable)
+	{
+		// drop any half-open samples when collection is turned off
+		if (!FT66InputLatency::bEnabled)
+		{
+			T66InputLatency::PendingSamples.Reset();
+			T66InputLatency::Arrivals.Reset();
+		}
+	}
+
+	static inline FAutoConsoleVariableRef CVarEnable{
+		TEXT("t66.InputLatency.Enable"),
+		FT66InputLatency::bEnabled,
+		TEXT("If true, measures the latency between a key press and the first visible frame of the action it triggers."),
+		FConsoleVariableDelegate::CreateStatic(&FT66InputLatencyConsole::OnEnableChanged),
+		ECVF_Cheat
+	};
+};
+
+static FAutoConsoleCommand CCmdT66InputLatencyDumpCSV(
+	TEXT("t66.InputLatency.DumpCSV"),
+	TEXT("Writes the per-action input latency histograms to Saved/Profiling/T66."),
+	FConsoleCommandDelegate::CreateStatic(&FT66InputLatency::DumpCSV)
+);
+
+static FAutoConsoleCommand CCmdT66InputLatencyReset(
+	TEXT("t66.InputLatency.Reset"),
+	TEXT("Clears all input latency histograms."),
+	FConsoleCommandDelegate::CreateStatic(&FT66InputLatency::Reset)
+);
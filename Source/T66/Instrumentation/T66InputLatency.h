@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+class ACharacter;
+class APlayerController;
+class UAnimMontage;
+
+DECLARE_STATS_GROUP(TEXT("T66 Input Latency"), STATGROUP_T66InputLatency, STATCAT_Advanced);
+
+/**
+ *  Player actions tracked by the input latency instrumentation
+ */
+enum class ET66InputLatencyAction : uint8
+{
+	ComboAttack,
+	ChargedAttack,
+	Jump,
+	Dash,
+
+	Num
+};
+
+/**
+ *  Input-to-action latency instrumentation.
+ *  - Player controllers timestamp raw key presses as they arrive from the viewport
+ *  - Character input handlers open a sample for the action they start
+ *  - The sample is closed on the first montage frame, or once the movement applies the action (jump count or impulse, dash mode)
+ *  Results are exposed through "stat T66InputLatency", the CSV profiler and t66.InputLatency.DumpCSV.
+ *  Disabled by default (t66.InputLatency.Enable). While disabled every entry point is a single branch.
+ */
+class FT66InputLatency
+{
+public:
+
+	/** Returns true if latency samples are being collected */
+	static FORCEINLINE bool IsEnabled() { return bEnabled; }
+
+	/** Timestamps a key press for the given player. Called from the player controllers */
+	static FORCEINLINE void NotifyInputArrived(const APlayerController* PlayerController)
+	{
+		if (bEnabled)
+		{
+			RecordInputArrival(PlayerController);
+		}
+	}
+
+	/** Opens a latency sample for an action started by a character input handler */
+	static FORCEINLINE void BeginAction(ET66InputLatencyAction Action, ACharacter* Character, const UAnimMontage* Montage = nullptr)
+	{
+		if (bEnabled)
+		{
+			OpenSample(Action, Character, Montage);
+		}
+	}
+
+	/** Writes the per-action histograms to a CSV file in the profiling directory */
+	static void DumpCSV();
+
+	/** Clears all histograms and pending samples */
+	static void Reset();
+
+private:
+
+	/** Slow path for NotifyInputArrived */
+	static void RecordInputArrival(const APlayerController* PlayerController);
+
+	/** Slow path for BeginAction */
+	static void OpenSample(ET66InputLatencyAction Action, ACharacter* Character, const UAnimMontage* Montage);
+
+	/** Collection toggle, bound to t66.InputLatency.Enable */
+	static bool bEnabled;
+
+	friend struct FT66InputLatencyConsole;
+};
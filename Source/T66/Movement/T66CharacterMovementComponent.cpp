@@ -0,0 +1,739 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66CharacterMovementComponent.h"
+
+#include "GameFramework/Character.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+namespace T66Movement
+{
+	/** Max one-way platforms passed through in a single movement sweep */
+	constexpr int32 MaxOneWayPassesPerMove = 4;
+}
+
+const FName UT66CharacterMovementComponent::OneWayPlatformTag(TEXT("OneWayPlatform"));
+
+UT66CharacterMovementComponent::UT66CharacterMovementComponent()
+{
+	// initialize the flags
+	bWantsToWallJump = false;
+	bWantsToDash = false;
+	bWantsToDropThrough = false;
+	bHasDashed = false;
+	bHasDoubleJumped = false;
+
+	// bind the wall probe completion delegate
+	WallProbeDelegate.BindUObject(this, &UT66CharacterMovementComponent::OnWallProbeComplete);
+}
+
+ET66MovementAbility UT66CharacterMovementComponent::HandleJumpPressed()
+{
+	if (!CharacterOwner)
+	{
+		return ET66MovementAbility::None;
+	}
+
+	// ignore jumps while dashing
+	if (IsDashing())
+	{
+		return ET66MovementAbility::None;
+	}
+
+	// we're grounded so just do a regular jump
+	if (!IsFalling())
+	{
+		CharacterOwner->Jump();
+		return ET66MovementAbility::GroundJump;
+	}
+
+	// ignore air jumps until the wall jump lockout expires
+	if (HasWallJumped())
+	{
+		return ET66MovementAbility::None;
+	}
+
+	// try for a wall jump first, using the cached wall probe. The jump itself is performed by the simulation so it can be predicted
+	if (HasWallContact())
+	{
+		bWantsToWallJump = true;
+		return ET66MovementAbility::WallJump;
+	}
+
+	// are we still within coyote time?
+	if (FallingTime < MaxCoyoteTime)
+	{
+		CharacterOwner->Jump();
+		return ET66MovementAbility::CoyoteJump;
+	}
+
+	// only double jump once while we're in the air. The flag is set by DoJump once the jump is applied
+	if (!bHasDoubleJumped)
+	{
+		CharacterOwner->Jump();
+		return ET66MovementAbility::DoubleJump;
+	}
+
+	return ET66MovementAbility::None;
+}
+
+bool UT66CharacterMovementComponent::RequestDash()
+{
+	// only dash once until we land
+	if (bHasDashed || IsDashing())
+	{
+		return false;
+	}
+
+	bWantsToDash = true;
+	return true;
+}
+
+bool UT66CharacterMovementComponent::RequestDropThrough()
+{
+	// we can only drop through a one-way platform we're standing on
+	if (!IsMovingOnGround() || !IsOneWayPlatform(CurrentFloor.HitResult.GetComponent()))
+	{
+		return false;
+	}
+
+	bWantsToDropThrough = true;
+	return true;
+}
+
+bool UT66CharacterMovementComponent::IsDashing() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(ET66CustomMovementMode::Dash);
+}
+
+bool UT66CharacterMovementComponent::HasWallContact() const
+{
+	if (!WallProbe.bHit)
+	{
+		return false;
+	}
+
+	// ignore stale results
+	const UWorld* World = GetWorld();
+
+	if (!World || World->GetTimeSeconds() - WallProbe.Time > WallProbeMaxAge)
+	{
+		return false;
+	}
+
+	// if we need input, make sure we're still pushing towards the wall we found
+	if (bWallJumpRequiresInput)
+	{
+		FVector ProbeDirection;
+
+		if (!GetWallProbeDirection(ProbeDirection) || FVector::DotProduct(ProbeDirection, WallProbe.ProbeDirection) < 0.5f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool UT66CharacterMovementComponent::IsWallSliding() const
+{
+	return IsFalling() && Velocity.Z < 0.0f && HasWallContact() && WallProbe.Distance <= WallSlideDistance;
+}
+
+void UT66CharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UpdateWallProbe(DeltaTime);
+}
+
+FNetworkPredictionData_Client* UT66CharacterMovementComponent::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == nullptr)
+	{
+		UT66CharacterMovementComponent* MutableThis = const_cast<UT66CharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FT66NetworkPredictionData_Client(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UT66CharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToWallJump = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	bWantsToDash = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+	bWantsToDropThrough = (Flags & FSavedMove_Character::FLAG_Custom_2) != 0;
+}
+
+void UT66CharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	// start a requested dash
+	if (bWantsToDash)
+	{
+		bWantsToDash = false;
+
+		if (!bHasDashed && !IsDashing())
+		{
+			bHasDashed = true;
+			DashTimeRemaining = DashDuration;
+
+			// reset the velocity so we don't carry momentum into the dash
+			Velocity = FVector::ZeroVector;
+
+			SetMovementMode(MOVE_Custom, static_cast<uint8>(ET66CustomMovementMode::Dash));
+
+			BroadcastMovementAbility(ET66MovementAbility::DashStart, UpdatedComponent->GetForwardVector());
+		}
+	}
+
+	// drop through the one-way platform we're standing on
+	if (bWantsToDropThrough)
+	{
+		bWantsToDropThrough = false;
+
+		UPrimitiveComponent* Floor = CurrentFloor.HitResult.GetComponent();
+
+		if (IsMovingOnGround() && IsOneWayPlatform(Floor))
+		{
+			IgnoreOneWayPlatform(Floor, true);
+			SetMovementMode(MOVE_Falling);
+		}
+	}
+
+	// perform a requested wall jump. The server checks its own probe, since it may be at a slightly different location
+	if (bWantsToWallJump)
+	{
+		bWantsToWallJump = false;
+
+		FVector WallNormal;
+
+		if (IsFalling() && !HasWallJumped() && GetWallJumpNormal(WallNormal))
+		{
+			PerformWallJump(WallNormal);
+		}
+	}
+}
+
+void UT66CharacterMovementComponent::UpdateCharacterStateAfterMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateAfterMovement(DeltaSeconds);
+
+	// collide with the one-way platforms we've passed through again
+	RestoreOneWayPlatforms();
+
+	// advance the wall jump lockout
+	WallJumpLockoutRemaining = FMath::Max(0.0f, WallJumpLockoutRemaining - DeltaSeconds);
+
+	// advance the coyote time
+	if (IsFalling())
+	{
+		FallingTime += DeltaSeconds;
+	}
+
+	// end the dash once its time runs out
+	if (IsDashing())
+	{
+		DashTimeRemaining -= DeltaSeconds;
+
+		if (DashTimeRemaining <= 0.0f)
+		{
+			EndDash();
+		}
+	}
+}
+
+bool UT66CharacterMovementComponent::DoJump(bool bReplayingMoves, float DeltaTime)
+{
+	// DoJump is called every frame while the jump is held, so only the first call starts a new jump
+	const bool bNewJump = CharacterOwner && !CharacterOwner->bWasJumping;
+
+	// classify the jump before the base class switches us to falling
+	ET66MovementAbility Ability = ET66MovementAbility::GroundJump;
+
+	if (IsFalling())
+	{
+		Ability = FallingTime < MaxCoyoteTime ? ET66MovementAbility::CoyoteJump : ET66MovementAbility::DoubleJump;
+	}
+
+	if (!Super::DoJump(bReplayingMoves, DeltaTime))
+	{
+		return false;
+	}
+
+	if (bNewJump)
+	{
+		if (Ability == ET66MovementAbility::DoubleJump)
+		{
+			bHasDoubleJumped = true;
+		}
+
+		BroadcastMovementAbility(Ability);
+	}
+
+	return true;
+}
+
+float UT66CharacterMovementComponent::GetMaxSpeed() const
+{
+	// dashes keep the walk speed cap so input while dashing behaves like air control
+	if (IsDashing())
+	{
+		return IsCrouching() ? MaxWalkSpeedCrouched : MaxWalkSpeed;
+	}
+
+	return Super::GetMaxSpeed();
+}
+
+void UT66CharacterMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+	// did we just start falling?
+	if (MovementMode == MOVE_Falling)
+	{
+		// coming out of a dash doesn't grant a coyote time jump
+		const bool bWasDashing = PreviousMovementMode == MOVE_Custom && PreviousCustomMode == static_cast<uint8>(ET66CustomMovementMode::Dash);
+
+		FallingTime = bWasDashing ? MaxCoyoteTime : 0.0f;
+	}
+
+	// reset the air ability state once we're back on the ground
+	if (IsMovingOnGround())
+	{
+		bHasDashed = false;
+		bHasDoubleJumped = false;
+	}
+}
+
+void UT66CharacterMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+	if (CustomMovementMode == static_cast<uint8>(ET66CustomMovementMode::Dash))
+	{
+		PhysDash(DeltaTime, Iterations);
+		return;
+	}
+
+	Super::PhysCustom(DeltaTime, Iterations);
+}
+
+bool UT66CharacterMovementComponent::MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit, ETeleportType Teleport)
+{
+	FHitResult LocalHit;
+	FHitResult& Hit = OutHit ? *OutHit : LocalHit;
+
+	bool bMoved = Super::MoveUpdatedComponentImpl(Delta, NewRotation, bSweep, &Hit, Teleport);
+
+	// pass through the one-way platforms we're not landing on, and finish the rest of the move
+	float MovedFraction = 0.0f;
+
+	for (int32 Pass = 0; bSweep && Hit.bBlockingHit && Pass < T66Movement::MaxOneWayPassesPerMove && ShouldPassThroughOneWayPlatform(Hit, Delta); ++Pass)
+	{
+		IgnoreOneWayPlatform(Hit.GetComponent());
+
+		MovedFraction += (1.0f - MovedFraction) * Hit.Time;
+		bMoved = Super::MoveUpdatedComponentImpl(Delta * (1.0f - MovedFraction), NewRotation, bSweep, &Hit, Teleport);
+	}
+
+	// report the hit time relative to the whole move
+	if (MovedFraction > 0.0f && Hit.bBlockingHit)
+	{
+		Hit.Time = MovedFraction + (1.0f - MovedFraction) * Hit.Time;
+	}
+
+	return bMoved;
+}
+
+void UT66CharacterMovementComponent::PhysDash(float DeltaTime, int32 Iterations)
+{
+	// dashes ignore gravity and are driven by the dash montage root motion, which flying physics already handles
+	PhysFlying(DeltaTime, Iterations);
+}
+
+void UT66CharacterMovementComponent::UpdateWallProbe(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+
+	// only probe while falling
+	if (!World || !UpdatedComponent || !CharacterOwner || !IsFalling())
+	{
+		WallProbe = FT66WallProbeResult();
+		WallProbeCountdown = 0.0f;
+		return;
+	}
+
+	// wait for the next probe interval and for the previous probe to complete
+	WallProbeCountdown -= DeltaTime;
+
+	if (WallProbeCountdown > 0.0f || WallProbeHandle.IsValid())
+	{
+		return;
+	}
+
+	WallProbeCountdown = WallProbeInterval;
+
+	FVector ProbeDirection;
+
+	if (!GetWallProbeDirection(ProbeDirection))
+	{
+		WallProbe = FT66WallProbeResult();
+		return;
+	}
+
+	const FVector TraceStart = UpdatedComponent->GetComponentLocation();
+	const FVector TraceEnd = TraceStart + (ProbeDirection * WallJumpTraceDistance);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(T66WallProbe), false, CharacterOwner);
+
+	PendingProbeDirection = ProbeDirection;
+	PendingProbeTime = World->GetTimeSeconds();
+
+	// use a line trace if we don't have a radius
+	if (WallJumpTraceRadius <= 0.0f)
+	{
+		WallProbeHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, WallJumpTraceChannel, QueryParams, FCollisionResponseParams::DefaultResponseParam, &WallProbeDelegate);
+	}
+	else
+	{
+		WallProbeHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, FQuat::Identity, WallJumpTraceChannel, FCollisionShape::MakeSphere(WallJumpTraceRadius), QueryParams, FCollisionResponseParams::DefaultResponseParam, &WallProbeDelegate);
+	}
+}
+
+void UT66CharacterMovementComponent::OnWallProbeComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	// ignore results from probes we've since abandoned
+	if (TraceHandle != WallProbeHandle)
+	{
+		return;
+	}
+
+	WallProbeHandle = FTraceHandle();
+
+	// we may have landed while the probe was in flight
+	if (!IsFalling())
+	{
+		return;
+	}
+
+	WallProbe = FT66WallProbeResult();
+	WallProbe.ProbeDirection = PendingProbeDirection;
+	WallProbe.Time = PendingProbeTime;
+
+	for (const FHitResult& Hit : TraceDatum.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			WallProbe.bHit = true;
+			WallProbe.Normal = Hit.ImpactNormal;
+			WallProbe.Distance = Hit.Distance;
+			break;
+		}
+	}
+}
+
+bool UT66CharacterMovementComponent::FindWallJumpSurface(FHitResult& OutHit) const
+{
+	if (!UpdatedComponent || !CharacterOwner)
+	{
+		return false;
+	}
+
+	FVector ProbeDirection;
+
+	if (!GetWallProbeDirection(ProbeDirection))
+	{
+		return false;
+	}
+
+	const FVector TraceStart = UpdatedComponent->GetComponentLocation();
+	const FVector TraceEnd = TraceStart + (ProbeDirection * WallJumpTraceDistance);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(T66WallJumpProbe), false, CharacterOwner);
+
+	// use a line trace if we don't have a radius
+	if (WallJumpTraceRadius <= 0.0f)
+	{
+		return GetWorld()->LineTraceSingleByChannel(OutHit, TraceStart, TraceEnd, WallJumpTraceChannel, QueryParams);
+	}
+
+	return GetWorld()->SweepSingleByChannel(OutHit, TraceStart, TraceEnd, FQuat::Identity, WallJumpTraceChannel, FCollisionShape::MakeSphere(WallJumpTraceRadius), QueryParams);
+}
+
+bool UT66CharacterMovementComponent::GetWallProbeDirection(FVector& OutDirection) const
+{
+	// look along the movement input
+	if (bWallJumpRequiresInput)
+	{
+		OutDirection = ConstrainDirectionToPlane(GetCurrentAcceleration()).GetSafeNormal2D();
+		return !OutDirection.IsNearlyZero();
+	}
+
+	// look ahead of the character
+	OutDirection = UpdatedComponent->GetForwardVector().GetSafeNormal2D();
+	return !OutDirection.IsNearlyZero();
+}
+
+bool UT66CharacterMovementComponent::GetWallJumpNormal(FVector& OutNormal) const
+{
+	// use the cached probe when we have one
+	if (HasWallContact())
+	{
+		OutNormal = WallProbe.Normal;
+		return true;
+	}
+
+	// the probe may not have completed yet, e.g. on the server right after a client started falling
+	FHitResult WallHit;
+
+	if (FindWallJumpSurface(WallHit))
+	{
+		OutNormal = WallHit.ImpactNormal;
+		return true;
+	}
+
+	return false;
+}
+
+void UT66CharacterMovementComponent::PerformWallJump(const FVector& WallNormal)
+{
+	// rotate the character to face away from the wall, so we're correctly oriented for the next wall jump
+	const FRotator WallOrientation(0.0f, WallNormal.ToOrientationRotator().Yaw, 0.0f);
+
+	MoveUpdatedComponent(FVector::ZeroVector, WallOrientation.Quaternion(), false);
+
+	// replace the current velocity with the wall jump velocity
+	FVector WallJumpVelocity = WallNormal.GetSafeNormal2D() * WallJumpHorizontalImpulse;
+	WallJumpVelocity.Z = WallJumpVerticalMultiplier > 0.0f ? JumpZVelocity * WallJumpVerticalMultiplier : WallJumpVerticalImpulse;
+
+	Velocity = ConstrainDirectionToPlane(WallJumpVelocity);
+
+	// lock out air jumps and movement input for a moment
+	WallJumpLockoutRemaining = DelayBetweenWallJumps;
+
+	// the wall is behind us now, so the cached probe no longer applies
+	WallProbe = FT66WallProbeResult();
+	WallProbeCountdown = 0.0f;
+
+	BroadcastMovementAbility(ET66MovementAbility::WallJump, WallNormal);
+}
+
+bool UT66CharacterMovementComponent::IsOneWayPlatform(const UPrimitiveComponent* Component)
+{
+	return Component && Component->ComponentHasTag(OneWayPlatformTag);
+}
+
+bool UT66CharacterMovementComponent::ShouldPassThroughOneWayPlatform(const FHitResult& Hit, const FVector& Delta) const
+{
+	if (!IsOneWayPlatform(Hit.GetComponent()))
+	{
+		return false;
+	}
+
+	// we started the move inside the platform, so get out of it
+	if (Hit.bStartPenetrating)
+	{
+		return true;
+	}
+
+	// only block when coming down onto the top of the platform
+	return Delta.Z > 0.0f || !IsWalkable(Hit);
+}
+
+void UT66CharacterMovementComponent::IgnoreOneWayPlatform(UPrimitiveComponent* Platform, bool bDropThrough)
+{
+	// the ignore list only affects this character, so other characters and platforms are unaffected
+	UpdatedPrimitive->IgnoreComponentWhenMoving(Platform, true);
+
+	FT66PassedOneWayPlatform* Passed = PassedOneWayPlatforms.FindByPredicate([Platform](const FT66PassedOneWayPlatform& Entry) { return Entry.Platform == Platform; });
+
+	if (!Passed)
+	{
+		Passed = &PassedOneWayPlatforms.AddDefaulted_GetRef();
+		Passed->Platform = Platform;
+	}
+
+	Passed->bDroppingThrough |= bDropThrough;
+}
+
+void UT66CharacterMovementComponent::RestoreOneWayPlatforms()
+{
+	if (PassedOneWayPlatforms.IsEmpty())
+	{
+		return;
+	}
+
+	const FBox CharacterBounds = UpdatedComponent->Bounds.GetBox();
+
+	for (int32 Index = PassedOneWayPlatforms.Num() - 1; Index >= 0; --Index)
+	{
+		FT66PassedOneWayPlatform& Passed = PassedOneWayPlatforms[Index];
+		UPrimitiveComponent* Platform = Passed.Platform.Get();
+
+		// we landed on something else before getting below the dropped platform
+		if (IsMovingOnGround())
+		{
+			Passed.bDroppingThrough = false;
+		}
+
+		// keep ignoring platforms we're dropping through or still inside of
+		if (Platform && FT66PassedOneWayPlatform::ShouldKeepIgnoring(CharacterBounds, Platform->Bounds.GetBox(), Passed.bDroppingThrough))
+		{
+			continue;
+		}
+
+		if (Platform)
+		{
+			UpdatedPrimitive->IgnoreComponentWhenMoving(Platform, false);
+		}
+
+		PassedOneWayPlatforms.RemoveAtSwap(Index);
+	}
+}
+
+void UT66CharacterMovementComponent::EndDash()
+{
+	if (!IsDashing())
+	{
+		return;
+	}
+
+	DashTimeRemaining = 0.0f;
+
+	// fall back to regular movement. If we're on the ground, the floor check will land us right away
+	SetMovementMode(MOVE_Falling);
+
+	BroadcastMovementAbility(ET66MovementAbility::DashEnd);
+}
+
+void UT66CharacterMovementComponent::BroadcastMovementAbility(ET66MovementAbility Ability, const FVector& Direction)
+{
+	// don't re-trigger cosmetic events while replaying moves after a server correction
+	if (CharacterOwner && CharacterOwner->bClientUpdating)
+	{
+		return;
+	}
+
+	OnMovementAbility.Broadcast(Ability, Direction);
+}
+
+bool FT66PassedOneWayPlatform::ShouldKeepIgnoring(const FBox& CharacterBounds, const FBox& PlatformBounds, bool& bInOutDroppingThrough)
+{
+	if (bInOutDroppingThrough)
+	{
+		// still above the top surface, so we haven't started passing through yet
+		if (CharacterBounds.Min.Z >= PlatformBounds.Max.Z)
+		{
+			return true;
+		}
+
+		// we're inside the platform now, so the overlap check takes over
+		bInOutDroppingThrough = false;
+	}
+
+	return CharacterBounds.Intersect(PlatformBounds);
+}
+
+void FT66SavedMove::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToWallJump = false;
+	bSavedWantsToDash = false;
+	bSavedWantsToDropThrough = false;
+	bSavedHasDashed = false;
+	bSavedHasDoubleJumped = false;
+
+	SavedWallJumpLockoutRemaining = 0.0f;
+	SavedDashTimeRemaining = 0.0f;
+	SavedFallingTime = 0.0f;
+}
+
+uint8 FT66SavedMove::GetCompressedFlags() const
+{
+	uint8 Flags = Super::GetCompressedFlags();
+
+	if (bSavedWantsToWallJump)
+	{
+		Flags |= FLAG_Custom_0;
+	}
+
+	if (bSavedWantsToDash)
+	{
+		Flags |= FLAG_Custom_1;
+	}
+
+	if (bSavedWantsToDropThrough)
+	{
+		Flags |= FLAG_Custom_2;
+	}
+
+	return Flags;
+}
+
+bool FT66SavedMove::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FT66SavedMove* Other = static_cast<const FT66SavedMove*>(NewMove.Get());
+
+	// never combine ability requests, they must reach the server on their own move
+	if (bSavedWantsToWallJump || Other->bSavedWantsToWallJump || bSavedWantsToDash || Other->bSavedWantsToDash || bSavedWantsToDropThrough || Other->bSavedWantsToDropThrough)
+	{
+		return false;
+	}
+
+	if (bSavedHasDashed != Other->bSavedHasDashed || bSavedHasDoubleJumped != Other->bSavedHasDoubleJumped)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FT66SavedMove::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const UT66CharacterMovementComponent* Movement = Cast<UT66CharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToWallJump = Movement->bWantsToWallJump;
+		bSavedWantsToDash = Movement->bWantsToDash;
+		bSavedWantsToDropThrough = Movement->bWantsToDropThrough;
+		bSavedHasDashed = Movement->bHasDashed;
+		bSavedHasDoubleJumped = Movement->bHasDoubleJumped;
+
+		SavedWallJumpLockoutRemaining = Movement->WallJumpLockoutRemaining;
+		SavedDashTimeRemaining = Movement->DashTimeRemaining;
+		SavedFallingTime = Movement->FallingTime;
+	}
+}
+
+void FT66SavedMove::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	if (UT66CharacterMovementComponent* Movement = Cast<UT66CharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		Movement->bWantsToWallJump = bSavedWantsToWallJump;
+		Movement->bWantsToDash = bSavedWantsToDash;
+		Movement->bWantsToDropThrough = bSavedWantsToDropThrough;
+		Movement->bHasDashed = bSavedHasDashed;
+		Movement->bHasDoubleJumped = bSavedHasDoubleJumped;
+
+		Movement->WallJumpLockoutRemaining = SavedWallJumpLockoutRemaining;
+		Movement->DashTimeRemaining = SavedDashTimeRemaining;
+		Movement->FallingTime = SavedFallingTime;
+	}
+}
+
+FT66NetworkPredictionData_Client::FT66NetworkPredictionData_Client(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FT66NetworkPredictionData_Client::AllocateNewMove()
+{
+	return FSavedMovePtr(new FT66SavedMove());
+}
@@ -0,0 +1,353 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "WorldCollision.h"
+#include "T66CharacterMovementComponent.generated.h"
+
+/**
+ *  Custom movement modes used by UT66CharacterMovementComponent (MOVE_Custom sub-modes)
+ */
+UENUM(BlueprintType)
+enum class ET66CustomMovementMode : uint8
+{
+	None	UMETA(Hidden),
+	Dash	UMETA(DisplayName = "Dash"),
+};
+
+/**
+ *  Movement abilities performed by UT66CharacterMovementComponent
+ */
+UENUM(BlueprintType)
+enum class ET66MovementAbility : uint8
+{
+	None,
+	GroundJump,
+	CoyoteJump,
+	DoubleJump,
+	WallJump,
+	DashStart,
+	DashEnd,
+};
+
+/**
+ *  Latest result of the asynchronous wall probe
+ */
+USTRUCT(BlueprintType)
+struct FT66WallProbeResult
+{
+	GENERATED_BODY()
+
+	/** True if the probe found a wall */
+	UPROPERTY(BlueprintReadOnly, Category="Wall Probe")
+	bool bHit = false;
+
+	/** Normal of the wall surface */
+	UPROPERTY(BlueprintReadOnly, Category="Wall Probe")
+	FVector Normal = FVector::ZeroVector;
+
+	/** Distance from the character to the wall */
+	UPROPERTY(BlueprintReadOnly, Category="Wall Probe")
+	float Distance = 0.0f;
+
+	/** Direction the probe was cast in */
+	FVector ProbeDirection = FVector::ZeroVector;
+
+	/** World time the probe was issued at */
+	double Time = 0.0;
+};
+
+/**
+ *  A one-way platform the character is currently passing through
+ */
+struct FT66PassedOneWayPlatform
+{
+	/** Platform being passed through */
+	TWeakObjectPtr<UPrimitiveComponent> Platform;
+
+	/** True after a drop request, until the character is below the platform's top surface */
+	bool bDroppingThrough = false;
+
+	/**
+	 *  Returns true if the platform should still be ignored.
+	 *  A dropped platform stays ignored while the character is still above its top, since a walking capsule floats
+	 *  slightly above the floor and isn't touching it on the first falling frame. Otherwise the bounds must overlap.
+	 */
+	static bool ShouldKeepIgnoring(const FBox& CharacterBounds, const FBox& PlatformBounds, bool& bInOutDroppingThrough);
+};
+
+/** Broadcast when a movement ability is performed. Direction is the wall normal for wall jumps */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FT66OnMovementAbility, ET66MovementAbility /*Ability*/, const FVector& /*Direction*/);
+
+/**
+ *  Character movement shared by the platforming and side scrolling characters.
+ *  Implements multi-jump, wall jump, coyote time and dash inside the movement simulation
+ *  so they are saved, replayed and corrected like regular movement:
+ *  - Wall jump and dash requests are sent to the server as saved move flags
+ *  - Wall jump lockout, dash time and coyote time are simulated time, not world timers
+ *  - Dash is a custom movement mode instead of a gravity scale override
+ *  Walls are found by a low frequency asynchronous probe that only runs while falling,
+ *  so jump presses only read the cached result.
+ *  Components tagged with OneWayPlatformTag are one-way platforms: movement sweeps pass through them
+ *  unless the character is coming down onto their top, and a drop request falls through the one we stand on.
+ */
+UCLASS()
+class UT66CharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+	friend class FT66SavedMove;
+
+public:
+
+	/** Constructor */
+	UT66CharacterMovementComponent();
+
+	/** Distance to trace ahead of the character to look for walls to jump from */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm"))
+	float WallJumpTraceDistance = 50.0f;
+
+	/** Radius of the wall jump sphere trace check. Zero uses a line trace */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 100, Units = "cm"))
+	float WallJumpTraceRadius = 25.0f;
+
+	/** Collision channel used to look for walls */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump")
+	TEnumAsByte<ECollisionChannel> WallJumpTraceChannel = ECC_Visibility;
+
+	/** If true, walls are only searched for along the movement input direction, and wall jumps require input */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump")
+	bool bWallJumpRequiresInput = false;
+
+	/** Time between asynchronous wall probes while falling */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 1, Units = "s"))
+	float WallProbeInterval = 0.05f;
+
+	/** Max age of a cached wall probe result before it's ignored */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 1, Units = "s"))
+	float WallProbeMaxAge = 0.15f;
+
+	/** Max distance to a wall to be considered wall sliding */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm"))
+	float WallSlideDistance = 20.0f;
+
+	/** Horizontal velocity to apply away from the wall when wall jumping */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 10000, Units = "cm/s"))
+	float WallJumpHorizontalImpulse = 800.0f;
+
+	/** Vertical velocity to apply when wall jumping. Only used if WallJumpVerticalMultiplier is zero */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 10000, Units = "cm/s"))
+	float WallJumpVerticalImpulse = 900.0f;
+
+	/** If greater than zero, the wall jump vertical velocity is JumpZVelocity times this, read at jump time */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 10))
+	float WallJumpVerticalMultiplier = 0.0f;
+
+	/** Time to ignore jump and movement inputs after a wall jump */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 5, Units = "s"))
+	float DelayBetweenWallJumps = 0.1f;
+
+	/** Max amount of time that can pass since we started falling when we allow a regular jump */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Coyote Time", meta = (ClampMin = 0, ClampMax = 5, Units = "s"))
+	float MaxCoyoteTime = 0.16f;
+
+	/** Time the character stays in the dash movement mode */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Dash", meta = (ClampMin = 0, ClampMax = 5, Units = "s"))
+	float DashDuration = 0.5f;
+
+	/** Called when a movement ability is performed. Not called while replaying moves after a correction */
+	FT66OnMovementAbility OnMovementAbility;
+
+	/** Component tag that marks one-way platforms */
+	static const FName OneWayPlatformTag;
+
+public:
+
+	/** Resolves a jump press into a ground, coyote, double or wall jump. Returns the ability that was requested; listeners are only notified once the simulation applies it */
+	ET66MovementAbility HandleJumpPressed();
+
+	/** Requests a dash on the next movement update. Returns false if the character can't dash right now */
+	bool RequestDash();
+
+	/** Requests a drop through the one-way platform we're standing on. Returns false if we're not standing on one */
+	bool RequestDropThrough();
+
+	/** Returns true if the character is in the dash movement mode */
+	UFUNCTION(BlueprintPure, Category="Movement")
+	bool IsDashing() const;
+
+	/** Returns true if the character has dashed since it last touched the ground */
+	UFUNCTION(BlueprintPure, Category="Movement")
+	bool HasDashed() const { return bHasDashed; }
+
+	/** Returns true while the post wall jump input lockout is active */
+	UFUNCTION(BlueprintPure, Category="Movement")
+	bool HasWallJumped() const { return WallJumpLockoutRemaining > 0.0f; }
+
+	/** Returns true if the character has double jumped since it last touched the ground */
+	UFUNCTION(BlueprintPure, Category="Movement")
+	bool HasDoubleJumped() const { return bHasDoubleJumped; }
+
+	/** Returns the latest wall probe result */
+	UFUNCTION(BlueprintPure, Category="Movement")
+	const FT66WallProbeResult& GetWallProbe() const { return WallProbe; }
+
+	/** Returns true if the latest wall probe found a wall and is recent enough to act on */
+	UFUNCTION(BlueprintPure, Category="Movement")
+	bool HasWallContact() const;
+
+	/** Returns true if the character is falling down along a wall. Meant to drive wall slide animations */
+	UFUNCTION(BlueprintPure, Category="Movement")
+	bool IsWallSliding() const;
+
+public:
+
+	// ~begin UCharacterMovementComponent interface
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+	virtual void UpdateCharacterStateAfterMovement(float DeltaSeconds) override;
+	virtual bool DoJump(bool bReplayingMoves, float DeltaTime) override;
+	virtual float GetMaxSpeed() const override;
+
+	// ~end UCharacterMovementComponent interface
+
+protected:
+
+	// ~begin UCharacterMovementComponent interface
+
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+	virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+
+	// ~end UCharacterMovementComponent interface
+
+	// ~begin UMovementComponent interface
+
+	virtual bool MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = nullptr, ETeleportType Teleport = ETeleportType::None) override;
+
+	// ~end UMovementComponent interface
+
+	/** Dash movement mode physics */
+	void PhysDash(float DeltaTime, int32 Iterations);
+
+	/** Issues a new asynchronous wall probe when due, or clears the cached result if we're not falling */
+	void UpdateWallProbe(float DeltaTime);
+
+	/** Asynchronous wall probe completion */
+	void OnWallProbeComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	/** Synchronously looks for a wall the character can jump from. Fallback for when there's no cached probe */
+	bool FindWallJumpSurface(FHitResult& OutHit) const;
+
+	/** Returns the direction to look for walls in. Returns false if there's no valid direction */
+	bool GetWallProbeDirection(FVector& OutDirection) const;
+
+	/** Returns the normal of the wall to jump from, preferring the cached probe */
+	bool GetWallJumpNormal(FVector& OutNormal) const;
+
+	/** Performs a wall jump off a wall with the provided normal */
+	void PerformWallJump(const FVector& WallNormal);
+
+	/** Returns true if the component is a one-way platform */
+	static bool IsOneWayPlatform(const UPrimitiveComponent* Component);
+
+	/** Returns true if a sweep hit against a one-way platform should be passed through */
+	bool ShouldPassThroughOneWayPlatform(const FHitResult& Hit, const FVector& Delta) const;
+
+	/** Ignores a one-way platform in our movement until we're clear of it. Dropped platforms stay ignored until we're below their top */
+	void IgnoreOneWayPlatform(UPrimitiveComponent* Platform, bool bDropThrough = false);
+
+	/** Stops ignoring the one-way platforms we're clear of */
+	void RestoreOneWayPlatforms();
+
+	/** Ends the dash movement mode. Only called from the simulated dash timer, so the end is predicted like the start */
+	void EndDash();
+
+	/** Notifies listeners of a movement ability, unless we're replaying moves */
+	void BroadcastMovementAbility(ET66MovementAbility Ability, const FVector& Direction = FVector::ZeroVector);
+
+protected:
+
+	/** Input request flags, sent to the server through the saved move compressed flags */
+	uint8 bWantsToWallJump : 1;
+	uint8 bWantsToDash : 1;
+	uint8 bWantsToDropThrough : 1;
+
+	/** Ability state, reset on landing */
+	uint8 bHasDashed : 1;
+	uint8 bHasDoubleJumped : 1;
+
+	/** Remaining simulated time for the post wall jump lockout */
+	float WallJumpLockoutRemaining = 0.0f;
+
+	/** Remaining simulated time for the current dash */
+	float DashTimeRemaining = 0.0f;
+
+	/** Simulated time since the character started falling, for coyote time jumps */
+	float FallingTime = 0.0f;
+
+	/** Latest wall probe result */
+	FT66WallProbeResult WallProbe;
+
+	/** Time left until the next wall probe */
+	float WallProbeCountdown = 0.0f;
+
+	/** Handle of the wall probe in flight, if any */
+	FTraceHandle WallProbeHandle;
+
+	/** Direction and issue time of the wall probe in flight */
+	FVector PendingProbeDirection = FVector::ZeroVector;
+	double PendingProbeTime = 0.0;
+
+	/** Wall probe completion delegate */
+	FTraceDelegate WallProbeDelegate;
+
+	/** One-way platforms we're currently passing through */
+	TArray<FT66PassedOneWayPlatform> PassedOneWayPlatforms;
+};
+
+/**
+ *  Saved move that carries the wall jump, dash and drop requests and restores the ability state when replaying
+ */
+class FT66SavedMove : public FSavedMove_Character
+{
+public:
+
+	typedef FSavedMove_Character Super;
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+protected:
+
+	uint8 bSavedWantsToWallJump : 1;
+	uint8 bSavedWantsToDash : 1;
+	uint8 bSavedWantsToDropThrough : 1;
+	uint8 bSavedHasDashed : 1;
+	uint8 bSavedHasDoubleJumped : 1;
+
+	float SavedWallJumpLockoutRemaining = 0.0f;
+	float SavedDashTimeRemaining = 0.0f;
+	float SavedFallingTime = 0.0f;
+};
+
+/**
+ *  Client prediction data that allocates FT66SavedMove
+ */
+class FT66NetworkPredictionData_Client : public FNetworkPredictionData_Client_Character
+{
+public:
+
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	FT66NetworkPredictionData_Client(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
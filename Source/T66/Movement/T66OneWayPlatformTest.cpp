@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66CharacterMovementComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace T66OneWayPlatformTest
+{
+	/** Capsule and platform sizes matching the side scrolling character and a thin soft platform */
+	constexpr float CapsuleRadius = 35.0f;
+	constexpr float CapsuleHalfHeight = 90.0f;
+	constexpr float PlatformTop = 0.0f;
+	constexpr float PlatformThickness = 20.0f;
+
+	/** Height a walking capsule floats above its floor (between MIN_FLOOR_DIST and MAX_FLOOR_DIST) */
+	constexpr float FloorDistance = 2.0f;
+
+	FBox MakeCharacterBounds(float CenterZ)
+	{
+		return FBox(FVector(-CapsuleRadius, -CapsuleRadius, CenterZ - CapsuleHalfHeight), FVector(CapsuleRadius, CapsuleRadius, CenterZ + CapsuleHalfHeight));
+	}
+
+	FBox MakePlatformBounds()
+	{
+		return FBox(FVector(-200.0f, -50.0f, PlatformTop - PlatformThickness), FVector(200.0f, 50.0f, PlatformTop));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FT66OneWayPlatformDropThroughTest, "T66.Movement.OneWayPlatform.DropThrough", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FT66OneWayPlatformDropThroughTest::RunTest(const FString& Parameters)
+{
+	using namespace T66OneWayPlatformTest;
+
+	const FBox PlatformBounds = MakePlatformBounds();
+
+	// standing on the platform without dropping: the platform isn't ignored, so we keep landing on it
+	{
+		bool bDroppingThrough = false;
+		TestFalse(TEXT("Standing on a platform doesn't ignore it"), FT66PassedOneWayPlatform::ShouldKeepIgnoring(MakeCharacterBounds(PlatformTop + CapsuleHalfHeight + FloorDistance), PlatformBounds, bDroppingThrough));
+	}
+
+	// drop through from a walking pose, falling with the side scrolling gravity at 60Hz
+	const float Gravity = -980.0f * 1.75f;
+	const float DeltaTime = 1.0f / 60.0f;
+
+	float CenterZ = PlatformTop + CapsuleHalfHeight + FloorDistance;
+	float VelocityZ = 0.0f;
+	bool bDroppingThrough = true;
+	bool bRestored = false;
+
+	for (int32 Frame = 0; Frame < 120 && !bRestored; ++Frame)
+	{
+		VelocityZ += Gravity * DeltaTime;
+		CenterZ += VelocityZ * DeltaTime;
+
+		const FBox CharacterBounds = MakeCharacterBounds(CenterZ);
+		const bool bClearBelow = CharacterBounds.Max.Z < PlatformBounds.Min.Z;
+
+		// the first falling frame doesn't reach the platform yet, which is where a plain overlap check restored it
+		if (Frame == 0)
+		{
+			TestFalse(TEXT("First falling frame is still above the platform"), CharacterBounds.Intersect(PlatformBounds));
+		}
+
+		const bool bKeepIgnoring = FT66PassedOneWayPlatform::ShouldKeepIgnoring(CharacterBounds, PlatformBounds, bDroppingThrough);
+
+		if (!bClearBelow)
+		{
+			if (!TestTrue(FString::Printf(TEXT("Platform stays ignored while dropping through (frame %d, bottom %.2f)"), Frame, CharacterBounds.Min.Z), bKeepIgnoring))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			TestFalse(TEXT("Platform is restored once we're below it"), bKeepIgnoring);
+			TestFalse(TEXT("Drop state is cleared once we're inside the platform"), bDroppingThrough);
+			bRestored = true;
+		}
+	}
+
+	TestTrue(TEXT("Character fell clear of the platform"), bRestored);
+
+	// jumping up through a platform: ignored while overlapping, restored once above it so we can land on top
+	{
+		bool bJumpingThrough = false;
+		TestTrue(TEXT("Platform stays ignored while jumping through it"), FT66PassedOneWayPlatform::ShouldKeepIgnoring(MakeCharacterBounds(PlatformTop + CapsuleHalfHeight - 5.0f), PlatformBounds, bJumpingThrough));
+		TestFalse(TEXT("Platform is restored once we're above it"), FT66PassedOneWayPlatform::ShouldKeepIgnoring(MakeCharacterBounds(PlatformTop + CapsuleHalfHeight + 5.0f), PlatformBounds, bJumpingThrough));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66GhostActor.h"
+#include "Components/SceneComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Animation/AnimationAsset.h"
+
+AT66GhostActor::AT66GhostActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	// ghosts are local only
+	bReplicates = false;
+	SetCanBeDamaged(false);
+
+	// create the root
+	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	SetRootComponent(Root);
+
+	// create the mesh, with no collision or overlaps
+	Mesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("Mesh"));
+	Mesh->SetupAttachment(Root);
+
+	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Mesh->SetGenerateOverlapEvents(false);
+	Mesh->SetCastShadow(false);
+	Mesh->bReceivesDecals = false;
+	Mesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+}
+
+void AT66GhostActor::InitializeGhost(USkeletalMesh* SkeletalMesh, const FTransform& MeshRelativeTransform)
+{
+	Mesh->SetSkeletalMeshAsset(SkeletalMesh);
+	Mesh->SetRelativeTransform(MeshRelativeTransform);
+
+	// play a single looping animation, if we have one
+	if (LoopingAnimation)
+	{
+		Mesh->PlayAnimation(LoopingAnimation, true);
+	}
+}
+
+void AT66GhostActor::SetGhostMovementMode(uint8 PackedMovementMode)
+{
+	if (PackedMovementMode == CurrentMovementMode)
+	{
+		return;
+	}
+
+	CurrentMovementMode = PackedMovementMode;
+
+	// custom modes are packed past MOVE_MAX
+	const EMovementMode NewMovementMode = PackedMovementMode >= MOVE_MAX ? MOVE_Custom : static_cast<EMovementMode>(PackedMovementMode);
+	const uint8 NewCustomMode = PackedMovementMode >= MOVE_MAX ? PackedMovementMode - MOVE_MAX : 0;
+
+	// swap to the mode's animation, falling back to the looping one
+	UAnimationAsset* const* ModeAnimation = ModeAnimations.Find(NewMovementMode);
+	UAnimationAsset* Animation = ModeAnimation && *ModeAnimation ? *ModeAnimation : LoopingAnimation;
+
+	if (Animation && Animation != Mesh->AnimationData.AnimToPlay)
+	{
+		Mesh->PlayAnimation(Animation, true);
+	}
+
+	BP_OnGhostMovementModeChanged(NewMovementMode, NewCustomMode);
+}
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Engine/EngineTypes.h"
+#include "T66GhostActor.generated.h"
+
+class USceneComponent;
+class USkeletalMeshComponent;
+class USkeletalMesh;
+class UAnimationAsset;
+
+/**
+ *  Lightweight visual stand-in for a recorded run.
+ *  Has no collision and doesn't tick: UT66GhostPlaybackSubsystem drives its transform.
+ */
+UCLASS()
+class AT66GhostActor : public AActor
+{
+	GENERATED_BODY()
+
+	/** Root component */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	USceneComponent* Root;
+
+	/** Ghost mesh */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	USkeletalMeshComponent* Mesh;
+
+protected:
+
+	/** Optional animation to loop on the ghost mesh, instead of running a full anim graph */
+	UPROPERTY(EditAnywhere, Category="Ghost")
+	UAnimationAsset* LoopingAnimation;
+
+	/** Optional animations to loop per recorded movement mode. Modes without one use LoopingAnimation */
+	UPROPERTY(EditAnywhere, Category="Ghost")
+	TMap<TEnumAsByte<EMovementMode>, UAnimationAsset*> ModeAnimations;
+
+	/** Recorded movement mode the ghost is currently showing, packed as in FT66GhostFrame */
+	uint8 CurrentMovementMode = MAX_uint8;
+
+	/** Lets Blueprints react to the ghost's recorded movement mode changing */
+	UFUNCTION(BlueprintImplementableEvent, Category="Ghost", meta = (DisplayName = "On Ghost Movement Mode Changed"))
+	void BP_OnGhostMovementModeChanged(EMovementMode NewMovementMode, uint8 NewCustomMode);
+
+public:
+
+	/** Constructor */
+	AT66GhostActor();
+
+	/** Sets up the ghost's look. The mesh transform is relative to the recorded character location */
+	void InitializeGhost(USkeletalMesh* SkeletalMesh, const FTransform& MeshRelativeTransform);
+
+	/** Shows a recorded movement mode, packed as in FT66GhostFrame. Does nothing if the mode hasn't changed */
+	void SetGhostMovementMode(uint8 PackedMovementMode);
+};
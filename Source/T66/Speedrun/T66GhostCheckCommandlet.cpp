@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66GhostCheckCommandlet.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "T66GhostRun.h"
+#include "T66.h"
+
+UT66GhostCheckCommandlet::UT66GhostCheckCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UT66GhostCheckCommandlet::Main(const FString& Params)
+{
+	FString GhostPath;
+
+	if (!FParse::Value(*Params, TEXT("Ghost="), GhostPath))
+	{
+		UE_LOG(LogT66, Error, TEXT("Usage: -run=T66GhostCheck -Ghost=<File> [-Baseline=<File>] [-ToleranceMs=<Ms>]"));
+		return 1;
+	}
+
+	uint32 ToleranceMs = 0;
+	FParse::Value(*Params, TEXT("ToleranceMs="), ToleranceMs);
+
+	// decode the run
+	TArray<uint8> Bytes;
+	FT66GhostRun Run;
+
+	if (!FFileHelper::LoadFileToArray(Bytes, *GhostPath) || !Run.Decode(Bytes))
+	{
+		UE_LOG(LogT66, Error, TEXT("Could not decode ghost run %s"), *GhostPath);
+		return 1;
+	}
+
+	int32 NumFailures = 0;
+
+	// serialization round-trip: the codec must be deterministic so runs can be compared byte for byte
+	TArray<uint8> Reencoded;
+	Run.Encode(Reencoded);
+
+	if (Reencoded != Bytes)
+	{
+		UE_LOG(LogT66, Error, TEXT("Ghost run %s doesn't re-encode to identical bytes"), *GhostPath);
+		++NumFailures;
+	}
+
+	// frames and events must be time ordered, and end by the total run time
+	for (int32 Index = 1; Index < Run.Frames.Num(); ++Index)
+	{
+		if (Run.Frames[Index].TimeMs < Run.Frames[Index - 1].TimeMs)
+		{
+			UE_LOG(LogT66, Error, TEXT("Ghost run %s frame %d goes back in time"), *GhostPath, Index);
+			++NumFailures;
+			break;
+		}
+	}
+
+	if (!Run.Frames.IsEmpty() && Run.Frames.Last().TimeMs > Run.TotalTimeMs)
+	{
+		UE_LOG(LogT66, Error, TEXT("Ghost run %s has frames past its total time"), *GhostPath);
+		++NumFailures;
+	}
+
+	UE_LOG(LogT66, Display, TEXT("Ghost run %s: level %s, %.3fs, %d frames, %d events, %d bytes"),
+		*GhostPath, *Run.LevelName, Run.TotalTimeMs / 1000.0f, Run.Frames.Num(), Run.Events.Num(), Bytes.Num());
+
+	// compare against the baseline
+	FString BaselinePath;
+
+	if (FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		FT66GhostRun Baseline;
+
+		if (!FT66GhostRun::LoadFromFile(BaselinePath, Baseline))
+		{
+			UE_LOG(LogT66, Error, TEXT("Could not decode baseline run %s"), *BaselinePath);
+			return 1;
+		}
+
+		if (Baseline.LevelName != Run.LevelName)
+		{
+			UE_LOG(LogT66, Error, TEXT("Baseline level %s doesn't match %s"), *Baseline.LevelName, *Run.LevelName);
+			++NumFailures;
+		}
+
+		const int64 TotalDeltaMs = static_cast<int64>(Run.TotalTimeMs) - Baseline.TotalTimeMs;
+
+		if (FMath::Abs(TotalDeltaMs) > ToleranceMs)
+		{
+			UE_LOG(LogT66, Error, TEXT("Total time %.3fs differs from baseline %.3fs by %lldms"), Run.TotalTimeMs / 1000.0f, Baseline.TotalTimeMs / 1000.0f, TotalDeltaMs);
+			++NumFailures;
+		}
+
+		// the same inputs must trigger the same abilities at the same times
+		if (Baseline.Events.Num() != Run.Events.Num())
+		{
+			UE_LOG(LogT66, Error, TEXT("Ability event count %d differs from baseline %d"), Run.Events.Num(), Baseline.Events.Num());
+			++NumFailures;
+		}
+		else
+		{
+			for (int32 Index = 0; Index < Run.Events.Num(); ++Index)
+			{
+				const FT66GhostEvent& Event = Run.Events[Index];
+				const FT66GhostEvent& BaselineEvent = Baseline.Events[Index];
+
+				const int64 EventDeltaMs = static_cast<int64>(Event.TimeMs) - BaselineEvent.TimeMs;
+
+				if (Event.Ability != BaselineEvent.Ability || FMath::Abs(EventDeltaMs) > ToleranceMs)
+				{
+					UE_LOG(LogT66, Error, TEXT("Ability event %d (%d at %ums) differs from baseline (%d at %ums)"), Index, Event.Ability, Event.TimeMs, BaselineEvent.Ability, BaselineEvent.TimeMs);
+					++NumFailures;
+					break;
+				}
+			}
+		}
+	}
+
+	if (NumFailures > 0)
+	{
+		UE_LOG(LogT66, Error, TEXT("Ghost check failed with %d error(s)"), NumFailures);
+		return 1;
+	}
+
+	UE_LOG(LogT66, Display, TEXT("Ghost check passed"));
+	return 0;
+}
@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "T66GhostCheckCommandlet.generated.h"
+
+/**
+ *  Headless consistency check for recorded ghost files.
+ *  - Serialization round-trip: the file decodes, is time ordered and re-encodes to identical bytes
+ *  - Optionally compares total time and ability event timings against a baseline recording
+ *  It doesn't load the level or re-simulate the run, so it can't detect a diverging simulation,
+ *  only a broken file or a recording whose timings differ from the baseline's.
+ *  Usage: -run=T66GhostCheck -Ghost=<File> [-Baseline=<File>] [-ToleranceMs=<Ms>]
+ *  Returns non-zero if any check fails.
+ */
+UCLASS()
+class UT66GhostCheckCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	UT66GhostCheckCommandlet();
+
+	/** Runs the checks */
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,249 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66GhostPlaybackSubsystem.h"
+#include "T66GhostActor.h"
+#include "Async/Async.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "T66RunTimerSubsystem.h"
+#include "T66.h"
+
+void UT66GhostPlaybackSubsystem::PlayGhostFiles(const TArray<FString>& FilePaths)
+{
+	for (const FString& FilePath : FilePaths)
+	{
+		// load and decode off the game thread, then hand the run back
+		Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<UT66GhostPlaybackSubsystem>(this), FilePath]()
+		{
+			TSharedRef<FT66GhostRun> Run = MakeShared<FT66GhostRun>();
+			const bool bLoaded = FT66GhostRun::LoadFromFile(FilePath, *Run);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, FilePath, Run, bLoaded]()
+			{
+				UT66GhostPlaybackSubsystem* Subsystem = WeakThis.Get();
+
+				if (!Subsystem)
+				{
+					return;
+				}
+
+				if (!bLoaded)
+				{
+					UE_LOG(LogT66, Warning, TEXT("Could not load ghost run %s"), *FilePath);
+					return;
+				}
+
+				Subsystem->PlayGhostRun(*Run);
+			});
+		});
+	}
+}
+
+void UT66GhostPlaybackSubsystem::PlayGhostRun(const FT66GhostRun& Run)
+{
+	// ghosts all start together
+	RestartGhosts();
+
+	FPlayback& Playback = Playbacks.AddDefaulted_GetRef();
+	Playback.Run = Run;
+
+	SpawnGhost(Playback);
+
+	UE_LOG(LogT66, Display, TEXT("Playing ghost run for %s (%.3fs)"), *Run.LevelName, Run.TotalTimeMs / 1000.0f);
+}
+
+void UT66GhostPlaybackSubsystem::StopGhosts()
+{
+	for (FPlayback& Playback : Playbacks)
+	{
+		if (AT66GhostActor* Ghost = Playback.Ghost.Get())
+		{
+			Ghost->Destroy();
+		}
+	}
+
+	Playbacks.Reset();
+}
+
+void UT66GhostPlaybackSubsystem::RestartGhosts()
+{
+	PlaybackStartTime = GetWorld()->GetTimeSeconds();
+
+	for (FPlayback& Playback : Playbacks)
+	{
+		Playback.Cursor = 0;
+	}
+}
+
+void UT66GhostPlaybackSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// stream the ghost class in ahead of time so spawning a ghost doesn't hitch
+	if (!GhostClass.IsNull())
+	{
+		GhostClassHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(GhostClass.ToSoftObjectPath());
+	}
+}
+
+void UT66GhostPlaybackSubsystem::Deinitialize()
+{
+	StopGhosts();
+
+	if (GhostClassHandle.IsValid())
+	{
+		GhostClassHandle->CancelHandle();
+		GhostClassHandle.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+void UT66GhostPlaybackSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const float PlaybackTime = GetPlaybackTime();
+
+	// sample every run and move its ghost
+	for (FPlayback& Playback : Playbacks)
+	{
+		AT66GhostActor* Ghost = Playback.Ghost.Get();
+
+		if (!Ghost)
+		{
+			continue;
+		}
+
+		FVector Location;
+		FRotator Rotation;
+		uint8 MovementMode;
+
+		if (Playback.Run.Sample(PlaybackTime, Location, Rotation, MovementMode, Playback.Cursor))
+		{
+			Ghost->SetActorLocationAndRotation(Location, Rotation);
+			Ghost->SetGhostMovementMode(MovementMode);
+		}
+	}
+}
+
+float UT66GhostPlaybackSubsystem::GetPlaybackTime() const
+{
+	const UWorld* World = GetWorld();
+
+	// runs are recorded on the run timer, so play them back on it too
+	if (const UT66RunTimerSubsystem* RunTimer = World->GetSubsystem<UT66RunTimerSubsystem>())
+	{
+		if (RunTimer->GetState() != ET66RunTimerState::Idle)
+		{
+			return static_cast<float>(RunTimer->GetRunTimeSeconds());
+		}
+	}
+
+	return static_cast<float>(World->GetTimeSeconds() - PlaybackStartTime);
+}
+
+TStatId UT66GhostPlaybackSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UT66GhostPlaybackSubsystem, STATGROUP_Tickables);
+}
+
+void UT66GhostPlaybackSubsystem::SpawnGhost(FPlayback& Playback)
+{
+	UWorld* World = GetWorld();
+
+	// nothing to see when running headless
+	if (!World || IsRunningDedicatedServer() || IsRunningCommandlet())
+	{
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	FVector Location;
+	FRotator Rotation;
+	uint8 MovementMode;
+	Playback.Run.Sample(GetPlaybackTime(), Location, Rotation, MovementMode, Playback.Cursor);
+
+	// the class is usually streamed in by now, so this doesn't block
+	UClass* Class = GhostClass.IsNull() ? AT66GhostActor::StaticClass() : GhostClass.LoadSynchronous();
+
+	if (!Class)
+	{
+		UE_LOG(LogT66, Warning, TEXT("Could not load ghost class %s"), *GhostClass.ToString());
+		Class = AT66GhostActor::StaticClass();
+	}
+
+	AT66GhostActor* Ghost = World->SpawnActor<AT66GhostActor>(Class, Location, Rotation, SpawnParams);
+
+	if (!Ghost)
+	{
+		return;
+	}
+
+	// borrow the look of the local player's character
+	if (const APlayerController* PlayerController = World->GetFirstPlayerController())
+	{
+		if (const ACharacter* Character = Cast<ACharacter>(PlayerController->GetPawn()))
+		{
+			const USkeletalMeshComponent* CharacterMesh = Character->GetMesh();
+			Ghost->InitializeGhost(CharacterMesh->GetSkeletalMeshAsset(), CharacterMesh->GetRelativeTransform());
+		}
+	}
+
+	Playback.Ghost = Ghost;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CCmdT66GhostPlay(
+	TEXT("t66.Ghost.Play"),
+	TEXT("Plays back ghost runs. Usage: t66.Ghost.Play [File ...]. With no files, plays the latest run for the current level."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UT66GhostPlaybackSubsystem* Subsystem = World ? World->GetSubsystem<UT66GhostPlaybackSubsystem>() : nullptr;
+
+		if (!Subsystem)
+		{
+			return;
+		}
+
+		TArray<FString> FilePaths = Args;
+
+		if (FilePaths.IsEmpty())
+		{
+			FString LevelName = World->GetMapName();
+			LevelName.RemoveFromStart(World->StreamingLevelsPrefix);
+
+			const FString Latest = FT66GhostRun::FindLatestGhostFile(LevelName);
+
+			if (Latest.IsEmpty())
+			{
+				UE_LOG(LogT66, Warning, TEXT("No ghost runs recorded for %s"), *LevelName);
+				return;
+			}
+
+			FilePaths.Add(Latest);
+		}
+
+		Subsystem->PlayGhostFiles(FilePaths);
+	})
+);
+
+static FAutoConsoleCommandWithWorld CCmdT66GhostStop(
+	TEXT("t66.Ghost.Stop"),
+	TEXT("Stops ghost playback."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UT66GhostPlaybackSubsystem* Subsystem = World ? World->GetSubsystem<UT66GhostPlaybackSubsystem>() : nullptr)
+		{
+			Subsystem->StopGhosts();
+		}
+	})
+);
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "T66GhostRun.h"
+#include "T66GhostPlaybackSubsystem.generated.h"
+
+class AT66GhostActor;
+struct FStreamableHandle;
+
+/**
+ *  Plays recorded runs back as ghosts.
+ *  Runs are loaded on a background thread, then sampled every frame and applied to
+ *  lightweight AT66GhostActor instances in a single batched update.
+ *  Ghosts follow the run timer while a run is in progress, so they line up with the player's timer.
+ *  Console: t66.Ghost.Play [File ...], t66.Ghost.Stop
+ */
+UCLASS(Config = Game)
+class UT66GhostPlaybackSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/** Ghost actor class to spawn, usually a Blueprint that sets the ghost's animations. Unset spawns AT66GhostActor */
+	UPROPERTY(Config)
+	TSoftClassPtr<AT66GhostActor> GhostClass;
+
+	/** Keeps the ghost class loaded */
+	TSharedPtr<FStreamableHandle> GhostClassHandle;
+
+	/** A run being played back */
+	struct FPlayback
+	{
+		/** Decoded run */
+		FT66GhostRun Run;
+
+		/** Spawned ghost, if any */
+		TWeakObjectPtr<AT66GhostActor> Ghost;
+
+		/** Index of the last frame sampled, to speed up forward playback */
+		int32 Cursor = 0;
+	};
+
+	/** Runs being played back */
+	TArray<FPlayback> Playbacks;
+
+	/** World time when playback started, for playback without a run in progress */
+	double PlaybackStartTime = 0.0;
+
+public:
+
+	/** Loads the given ghost files on a background thread and plays them back once loaded */
+	void PlayGhostFiles(const TArray<FString>& FilePaths);
+
+	/** Plays an already decoded run */
+	void PlayGhostRun(const FT66GhostRun& Run);
+
+	/** Stops playback and destroys all ghosts */
+	void StopGhosts();
+
+	/** Restarts every ghost from the beginning of its run */
+	void RestartGhosts();
+
+	/** Returns the number of runs being played back */
+	int32 GetNumGhosts() const { return Playbacks.Num(); }
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return !Playbacks.IsEmpty(); }
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Spawns the visual ghost for a playback */
+	void SpawnGhost(FPlayback& Playback);
+
+	/** Returns the time to sample the runs at: the run timer's time during a run, otherwise the time since playback started */
+	float GetPlaybackTime() const;
+};
@@ -0,0 +1,247 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66GhostRecorderComponent.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+#include "T66CharacterMovementComponent.h"
+#include "T66RunTimerSubsystem.h"
+
+UT66GhostRecorderComponent::UT66GhostRecorderComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// sample after movement so we record this frame's transform
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+	LastRunTimerState = ET66RunTimerState::Idle;
+}
+
+void UT66GhostRecorderComponent::StartRecording()
+{
+	UWorld* World = GetWorld();
+	ACharacter* Character = Cast<ACharacter>(GetOwner());
+
+	if (!World || !Character)
+	{
+		return;
+	}
+
+	// reset the run
+	Run = FT66GhostRun();
+	Run.LevelName = World->GetMapName();
+	Run.LevelName.RemoveFromStart(World->StreamingLevelsPrefix);
+	Run.SampleRate = static_cast<uint16>(SampleRate);
+
+	// preallocate for a few minutes of samples
+	Run.Frames.Reserve(SampleRate * 180);
+
+	RecordingStartTime = World->GetTimeSeconds();
+
+	// listen for ability events
+	if (!bRecording)
+	{
+		if (UT66CharacterMovementComponent* Movement = Cast<UT66CharacterMovementComponent>(Character->GetCharacterMovement()))
+		{
+			Movement->OnMovementAbility.AddUObject(this, &UT66GhostRecorderComponent::OnMovementAbility);
+		}
+	}
+
+	// save when the run finishes
+	if (!RunTimerStateHandle.IsValid())
+	{
+		if (UT66RunTimerSubsystem* RunTimer = World->GetSubsystem<UT66RunTimerSubsystem>())
+		{
+			RunTimerStateHandle = RunTimer->OnStateChanged.AddUObject(this, &UT66GhostRecorderComponent::OnRunTimerStateChanged);
+			LastRunTimerState = RunTimer->GetState();
+		}
+	}
+
+	bRecording = true;
+	SetComponentTickEnabled(true);
+
+	// record the starting pose
+	RecordFrame();
+}
+
+FString UT66GhostRecorderComponent::StopRecording(bool bSave)
+{
+	if (!bRecording)
+	{
+		return FString();
+	}
+
+	// record the final pose
+	RecordFrame();
+
+	Run.TotalTimeMs = GetRunTimeMs();
+
+	bRecording = false;
+	SetComponentTickEnabled(false);
+
+	if (ACharacter* Character = Cast<ACharacter>(GetOwner()))
+	{
+		if (UT66CharacterMovementComponent* Movement = Cast<UT66CharacterMovementComponent>(Character->GetCharacterMovement()))
+		{
+			Movement->OnMovementAbility.RemoveAll(this);
+		}
+	}
+
+	// skip runs that are too short to be useful
+	if (!bSave || Run.TotalTimeMs < MinSavedRunTime * 1000.0f)
+	{
+		return FString();
+	}
+
+	// encode and write on a background thread
+	const FString FilePath = FT66GhostRun::MakeGhostFilePath(Run.LevelName);
+	Run.SaveAsync(FilePath, MaxSavedRunsPerLevel);
+
+	return FilePath;
+}
+
+void UT66GhostRecorderComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!bRecordOnBeginPlay)
+	{
+		return;
+	}
+
+	// only record runs for the local player
+	if (APawn* Pawn = Cast<APawn>(GetOwner()))
+	{
+		if (Pawn->IsLocallyControlled())
+		{
+			StartRecording();
+		}
+		else
+		{
+			// we're usually spawned before being possessed
+			Pawn->ReceiveControllerChangedDelegate.AddDynamic(this, &UT66GhostRecorderComponent::OnControllerChanged);
+		}
+	}
+}
+
+void UT66GhostRecorderComponent::OnControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	if (!bRecording && Pawn && Pawn->IsLocallyControlled())
+	{
+		Pawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UT66GhostRecorderComponent::OnControllerChanged);
+		StartRecording();
+	}
+}
+
+void UT66GhostRecorderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// unfinished runs are only kept if asked for, so respawns and level changes don't pile up files
+	StopRecording(bSaveUnfinishedRuns && (EndPlayReason == EEndPlayReason::Destroyed || EndPlayReason == EEndPlayReason::LevelTransition));
+
+	if (RunTimerStateHandle.IsValid())
+	{
+		if (UT66RunTimerSubsystem* RunTimer = GetWorld() ? GetWorld()->GetSubsystem<UT66RunTimerSubsystem>() : nullptr)
+		{
+			RunTimer->OnStateChanged.Remove(RunTimerStateHandle);
+		}
+
+		RunTimerStateHandle.Reset();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UT66GhostRecorderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!bRecording)
+	{
+		return;
+	}
+
+	// sample at a fixed rate of run time, regardless of the frame rate. Nothing is sampled while the timer is paused
+	if (GetRunTimeMs() >= NextSampleTimeMs)
+	{
+		RecordFrame();
+	}
+}
+
+void UT66GhostRecorderComponent::OnRunTimerStateChanged(ET66RunTimerState State)
+{
+	const ET66RunTimerState PreviousState = LastRunTimerState;
+	LastRunTimerState = State;
+
+	switch (State)
+	{
+	case ET66RunTimerState::Finished:
+		StopRecording(true);
+		break;
+
+	case ET66RunTimerState::Running:
+		// a new run restarts the recording so the ghost lines up with the timer. Resuming from a pause keeps it going
+		if (PreviousState != ET66RunTimerState::Paused)
+		{
+			StartRecording();
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UT66GhostRecorderComponent::RecordFrame()
+{
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+
+	if (!Character)
+	{
+		return;
+	}
+
+	FT66GhostFrame& Frame = Run.Frames.AddDefaulted_GetRef();
+	Frame.TimeMs = GetRunTimeMs();
+
+	// schedule the next sample on the sampling grid, skipping any we missed on a long frame
+	const uint32 SampleIntervalMs = FMath::Max(1, 1000 / SampleRate);
+	NextSampleTimeMs = (Frame.TimeMs / SampleIntervalMs + 1) * SampleIntervalMs;
+	Frame.Location = FT66GhostRun::QuantizeLocation(Character->GetActorLocation());
+	Frame.Yaw = FT66GhostRun::QuantizeYaw(Character->GetActorRotation().Yaw);
+
+	// fold custom movement modes after the built-in ones
+	if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+	{
+		Frame.MovementMode = Movement->MovementMode == MOVE_Custom ? static_cast<uint8>(MOVE_MAX + Movement->CustomMovementMode) : static_cast<uint8>(Movement->MovementMode.GetValue());
+	}
+}
+
+void UT66GhostRecorderComponent::OnMovementAbility(ET66MovementAbility Ability, const FVector& Direction)
+{
+	FT66GhostEvent& Event = Run.Events.AddDefaulted_GetRef();
+	Event.TimeMs = GetRunTimeMs();
+	Event.Ability = static_cast<uint8>(Ability);
+}
+
+uint32 UT66GhostRecorderComponent::GetRunTimeMs() const
+{
+	const UWorld* World = GetWorld();
+
+	if (!World)
+	{
+		return 0;
+	}
+
+	// follow the run timer, so pauses and splits line up with what the player saw
+	if (const UT66RunTimerSubsystem* RunTimer = World->GetSubsystem<UT66RunTimerSubsystem>())
+	{
+		if (RunTimer->GetState() != ET66RunTimerState::Idle)
+		{
+			return static_cast<uint32>(FMath::Max<int64>(0, RunTimer->GetRunTimeUs() / 1000));
+		}
+	}
+
+	// no run in progress, so time the recording on its own
+	return static_cast<uint32>(FMath::Max(0.0, (World->GetTimeSeconds() - RecordingStartTime) * 1000.0));
+}
@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "T66GhostRun.h"
+#include "T66GhostRecorderComponent.generated.h"
+
+enum class ET66MovementAbility : uint8;
+enum class ET66RunTimerState : uint8;
+
+/**
+ *  Records the owning character's run for ghost playback:
+ *  - Samples location, yaw and movement mode at a fixed rate of run timer time (world time before the timer starts)
+ *  - Records movement ability events as they happen
+ *  - Writes the run to Saved/Ghosts on a background thread when the run timer finishes,
+ *    keeping the newest MaxSavedRunsPerLevel files per level
+ *  - Restarts recording when the run timer starts a new run, so ghosts line up with the timer
+ *  Only records for locally controlled characters.
+ */
+UCLASS(ClassGroup = "T66", meta = (BlueprintSpawnableComponent))
+class UT66GhostRecorderComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Number of samples to record per second */
+	UPROPERTY(EditAnywhere, Category="Ghost", meta = (ClampMin = 1, ClampMax = 120, Units = "Hz"))
+	int32 SampleRate = 30;
+
+	/** If true, recording starts automatically when play begins */
+	UPROPERTY(EditAnywhere, Category="Ghost")
+	bool bRecordOnBeginPlay = true;
+
+	/** Runs shorter than this aren't saved when recording stops */
+	UPROPERTY(EditAnywhere, Category="Ghost", meta = (ClampMin = 0, Units = "s"))
+	float MinSavedRunTime = 1.0f;
+
+	/** Ghost files kept per level. Older ones are deleted when a new run is saved. Zero keeps every file */
+	UPROPERTY(EditAnywhere, Category="Ghost", meta = (ClampMin = 0))
+	int32 MaxSavedRunsPerLevel = 5;
+
+	/** If true, runs that end without finishing (pawn destroyed, level change) are saved too */
+	UPROPERTY(EditAnywhere, Category="Ghost")
+	bool bSaveUnfinishedRuns = false;
+
+	/** Run timer state change subscription */
+	FDelegateHandle RunTimerStateHandle;
+
+	/** Last run timer state we were told about, to tell a new run from a resumed one */
+	ET66RunTimerState LastRunTimerState;
+
+	/** Run being recorded */
+	FT66GhostRun Run;
+
+	/** World time when the recording started, for runs recorded without the run timer */
+	double RecordingStartTime = 0.0;
+
+	/** Run time of the next sample, in milliseconds */
+	uint32 NextSampleTimeMs = 0;
+
+	/** True while recording */
+	bool bRecording = false;
+
+public:
+
+	/** Constructor */
+	UT66GhostRecorderComponent();
+
+	/** Starts a new recording, discarding any run in progress */
+	UFUNCTION(BlueprintCallable, Category="Ghost")
+	void StartRecording();
+
+	/** Stops recording, optionally writing the run to disk. Returns the file path if the run was saved */
+	UFUNCTION(BlueprintCallable, Category="Ghost")
+	FString StopRecording(bool bSave = true);
+
+	/** Returns true while recording */
+	UFUNCTION(BlueprintPure, Category="Ghost")
+	bool IsRecording() const { return bRecording; }
+
+	/** Returns the run recorded so far */
+	const FT66GhostRun& GetRun() const { return Run; }
+
+protected:
+
+	/** Starts recording if configured to */
+	virtual void BeginPlay() override;
+
+	/** Stops the run in progress, saving it only if bSaveUnfinishedRuns is set */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Samples the owner at the configured rate */
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Starts recording once the owner is possessed by a local player */
+	UFUNCTION()
+	void OnControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+	/** Saves the run when the run timer finishes, and restarts recording when a new run starts */
+	void OnRunTimerStateChanged(ET66RunTimerState State);
+
+	/** Records a sample of the owner's current state */
+	void RecordFrame();
+
+	/** Records a movement ability event */
+	void OnMovementAbility(ET66MovementAbility Ability, const FVector& Direction);
+
+	/** Returns the current run time in milliseconds, from the run timer while a run is in progress */
+	uint32 GetRunTimeMs() const;
+};
@@ -0,0 +1,403 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66GhostRun.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "T66.h"
+
+namespace T66Ghost
+{
+	/** File signature */
+	constexpr uint32 Magic = 0x48473654; // 'T6GH'
+
+	/** Format version. Bump when the stream layout changes */
+	constexpr uint16 Version = 1;
+
+	/** Ghost file extension */
+	const TCHAR* FileExtension = TEXT(".t66ghost");
+
+	/** Returns true if the file name is LevelName-<timestamp> as written by MakeGhostFilePath, so levels sharing a name prefix don't match */
+	bool IsGhostFileForLevel(const FString& FileName, const FString& LevelName)
+	{
+		const FString BaseName = FPaths::GetBaseFilename(FileName);
+
+		if (!BaseName.StartsWith(LevelName + TEXT("-"), ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+
+		// FDateTime::ToString() format: YYYY.MM.DD-HH.MM.SS
+		const FString Stamp = BaseName.RightChop(LevelName.Len() + 1);
+		const TCHAR* StampPattern = TEXT("0000.00.00-00.00.00");
+
+		if (Stamp.Len() != FCString::Strlen(StampPattern))
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < Stamp.Len(); ++Index)
+		{
+			if (StampPattern[Index] == TEXT('0') ? !FChar::IsDigit(Stamp[Index]) : Stamp[Index] != StampPattern[Index])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Appends an unsigned varint */
+	void WriteVarUInt(TArray<uint8>& Bytes, uint32 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Bytes.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+
+		Bytes.Add(static_cast<uint8>(Value));
+	}
+
+	/** Appends a signed varint, zigzag encoded so small negative deltas stay small */
+	void WriteVarInt(TArray<uint8>& Bytes, int32 Value)
+	{
+		WriteVarUInt(Bytes, (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31));
+	}
+
+	/** Sequential reader over an encoded stream */
+	struct FReader
+	{
+		const TArray<uint8>& Bytes;
+		int32 Offset = 0;
+		bool bError = false;
+
+		explicit FReader(const TArray<uint8>& InBytes) : Bytes(InBytes) {}
+
+		uint8 ReadByte()
+		{
+			if (!Bytes.IsValidIndex(Offset))
+			{
+				bError = true;
+				return 0;
+			}
+
+			return Bytes[Offset++];
+		}
+
+		uint32 ReadVarUInt()
+		{
+			uint32 Value = 0;
+
+			for (int32 Shift = 0; Shift < 35; Shift += 7)
+			{
+				const uint8 Byte = ReadByte();
+				Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+
+				if ((Byte & 0x80) == 0 || bError)
+				{
+					return Value;
+				}
+			}
+
+			// more than 5 bytes is never valid for a 32 bit value
+			bError = true;
+			return Value;
+		}
+
+		int32 ReadVarInt()
+		{
+			const uint32 Value = ReadVarUInt();
+			return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+		}
+	};
+}
+
+FIntVector FT66GhostRun::QuantizeLocation(const FVector& Location)
+{
+	return FIntVector(FMath::RoundToInt32(Location.X), FMath::RoundToInt32(Location.Y), FMath::RoundToInt32(Location.Z));
+}
+
+uint16 FT66GhostRun::QuantizeYaw(float YawDegrees)
+{
+	return static_cast<uint16>(FMath::RoundToInt32(FRotator::ClampAxis(YawDegrees) * (65536.0f / 360.0f)) & 0xFFFF);
+}
+
+FVector FT66GhostRun::DequantizeLocation(const FIntVector& Location)
+{
+	return FVector(Location);
+}
+
+float FT66GhostRun::DequantizeYaw(uint16 Yaw)
+{
+	return Yaw * (360.0f / 65536.0f);
+}
+
+void FT66GhostRun::Encode(TArray<uint8>& OutBytes) const
+{
+	using namespace T66Ghost;
+
+	OutBytes.Reset();
+
+	// roughly 6 bytes per frame once delta encoded
+	OutBytes.Reserve(64 + Frames.Num() * 6 + Events.Num() * 3);
+
+	// header
+	WriteVarUInt(OutBytes, Magic);
+	WriteVarUInt(OutBytes, Version);
+	WriteVarUInt(OutBytes, SampleRate);
+	WriteVarUInt(OutBytes, TotalTimeMs);
+
+	const FTCHARToUTF8 LevelNameUtf8(*LevelName);
+	WriteVarUInt(OutBytes, LevelNameUtf8.Length());
+	OutBytes.Append(reinterpret_cast<const uint8*>(LevelNameUtf8.Get()), LevelNameUtf8.Length());
+
+	WriteVarUInt(OutBytes, Frames.Num());
+	WriteVarUInt(OutBytes, Events.Num());
+
+	// frames, each relative to the previous one
+	FT66GhostFrame Previous;
+
+	for (const FT66GhostFrame& Frame : Frames)
+	{
+		WriteVarUInt(OutBytes, Frame.TimeMs - Previous.TimeMs);
+		WriteVarInt(OutBytes, Frame.Location.X - Previous.Location.X);
+		WriteVarInt(OutBytes, Frame.Location.Y - Previous.Location.Y);
+		WriteVarInt(OutBytes, Frame.Location.Z - Previous.Location.Z);
+		WriteVarInt(OutBytes, static_cast<int16>(Frame.Yaw - Previous.Yaw));
+		WriteVarInt(OutBytes, Frame.MovementMode - Previous.MovementMode);
+
+		Previous = Frame;
+	}
+
+	// events, relative to the previous event time
+	uint32 PreviousEventTime = 0;
+
+	for (const FT66GhostEvent& Event : Events)
+	{
+		WriteVarUInt(OutBytes, Event.TimeMs - PreviousEventTime);
+		OutBytes.Add(Event.Ability);
+
+		PreviousEventTime = Event.TimeMs;
+	}
+}
+
+bool FT66GhostRun::Decode(const TArray<uint8>& Bytes)
+{
+	using namespace T66Ghost;
+
+	FReader Reader(Bytes);
+
+	// header
+	if (Reader.ReadVarUInt() != Magic || Reader.ReadVarUInt() != Version)
+	{
+		return false;
+	}
+
+	SampleRate = static_cast<uint16>(Reader.ReadVarUInt());
+	TotalTimeMs = Reader.ReadVarUInt();
+
+	const uint32 LevelNameLength = Reader.ReadVarUInt();
+
+	if (Reader.bError || Reader.Offset + static_cast<int64>(LevelNameLength) > Bytes.Num())
+	{
+		return false;
+	}
+
+	LevelName = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Reader.Offset), LevelNameLength));
+	Reader.Offset += LevelNameLength;
+
+	const uint32 NumFrames = Reader.ReadVarUInt();
+	const uint32 NumEvents = Reader.ReadVarUInt();
+
+	// every frame and event takes at least a few bytes, so reject counts the stream can't hold
+	if (Reader.bError || NumFrames > static_cast<uint32>(Bytes.Num()) || NumEvents > static_cast<uint32>(Bytes.Num()))
+	{
+		return false;
+	}
+
+	// frames
+	Frames.SetNumUninitialized(NumFrames);
+
+	FT66GhostFrame Previous;
+
+	for (FT66GhostFrame& Frame : Frames)
+	{
+		Frame.TimeMs = Previous.TimeMs + Reader.ReadVarUInt();
+		Frame.Location.X = Previous.Location.X + Reader.ReadVarInt();
+		Frame.Location.Y = Previous.Location.Y + Reader.ReadVarInt();
+		Frame.Location.Z = Previous.Location.Z + Reader.ReadVarInt();
+		Frame.Yaw = static_cast<uint16>(Previous.Yaw + Reader.ReadVarInt());
+		Frame.MovementMode = static_cast<uint8>(Previous.MovementMode + Reader.ReadVarInt());
+
+		Previous = Frame;
+	}
+
+	// events
+	Events.SetNumUninitialized(NumEvents);
+
+	uint32 PreviousEventTime = 0;
+
+	for (FT66GhostEvent& Event : Events)
+	{
+		Event.TimeMs = PreviousEventTime + Reader.ReadVarUInt();
+		Event.Ability = Reader.ReadByte();
+
+		PreviousEventTime = Event.TimeMs;
+	}
+
+	return !Reader.bError;
+}
+
+bool FT66GhostRun::Sample(float TimeSeconds, FVector& OutLocation, FRotator& OutRotation, uint8& OutMovementMode, int32& InOutCursor) const
+{
+	if (Frames.IsEmpty())
+	{
+		return false;
+	}
+
+	const float TimeMs = TimeSeconds * 1000.0f;
+
+	// rewind the cursor if we're seeking backwards
+	if (!Frames.IsValidIndex(InOutCursor) || Frames[InOutCursor].TimeMs > TimeMs)
+	{
+		InOutCursor = 0;
+	}
+
+	// advance the cursor to the last frame at or before the sample time
+	while (InOutCursor + 1 < Frames.Num() && Frames[InOutCursor + 1].TimeMs <= TimeMs)
+	{
+		++InOutCursor;
+	}
+
+	const FT66GhostFrame& From = Frames[InOutCursor];
+	const FT66GhostFrame& To = Frames[FMath::Min(InOutCursor + 1, Frames.Num() - 1)];
+
+	const float Span = static_cast<float>(To.TimeMs - From.TimeMs);
+	const float Alpha = Span > 0.0f ? FMath::Clamp((TimeMs - From.TimeMs) / Span, 0.0f, 1.0f) : 0.0f;
+
+	OutLocation = FMath::Lerp(DequantizeLocation(From.Location), DequantizeLocation(To.Location), Alpha);
+
+	// interpolate the yaw along the shortest path
+	const float FromYaw = DequantizeYaw(From.Yaw);
+	OutRotation = FRotator(0.0f, FromYaw + FMath::FindDeltaAngleDegrees(FromYaw, DequantizeYaw(To.Yaw)) * Alpha, 0.0f);
+
+	OutMovementMode = From.MovementMode;
+
+	return true;
+}
+
+void FT66GhostRun::SaveAsync(const FString& FilePath, int32 MaxFilesPerLevel) const
+{
+	// copy the run so the recorder can keep going while we encode and write
+	Async(EAsyncExecution::ThreadPool, [Run = *this, FilePath, MaxFilesPerLevel]()
+	{
+		TArray<uint8> Bytes;
+		Run.Encode(Bytes);
+
+		if (FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+		{
+			UE_LOG(LogT66, Display, TEXT("Ghost run written to %s (%d frames, %d bytes)"), *FilePath, Run.Frames.Num(), Bytes.Num());
+
+			// prune after the write so the new file counts towards the limit
+			if (MaxFilesPerLevel > 0)
+			{
+				PruneGhostFiles(Run.LevelName, MaxFilesPerLevel);
+			}
+		}
+		else
+		{
+			UE_LOG(LogT66, Error, TEXT("Could not write ghost run to %s"), *FilePath);
+		}
+	});
+}
+
+bool FT66GhostRun::LoadFromFile(const FString& FilePath, FT66GhostRun& OutRun)
+{
+	TArray<uint8> Bytes;
+
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	return OutRun.Decode(Bytes);
+}
+
+FString FT66GhostRun::GetGhostDir()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Ghosts");
+}
+
+FString FT66GhostRun::MakeGhostFilePath(const FString& LevelName)
+{
+	return GetGhostDir() / FString::Printf(TEXT("%s-%s%s"), *LevelName, *FDateTime::Now().ToString(), T66Ghost::FileExtension);
+}
+
+FString FT66GhostRun::FindLatestGhostFile(const FString& LevelName)
+{
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(GetGhostDir() / (LevelName.IsEmpty() ? TEXT("*") : LevelName + TEXT("-*")) + T66Ghost::FileExtension), true, false);
+
+	FString Latest;
+	FDateTime LatestTime = FDateTime::MinValue();
+
+	for (const FString& FileName : FileNames)
+	{
+		if (!LevelName.IsEmpty() && !T66Ghost::IsGhostFileForLevel(FileName, LevelName))
+		{
+			continue;
+		}
+
+		const FString FilePath = GetGhostDir() / FileName;
+		const FDateTime FileTime = IFileManager::Get().GetTimeStamp(*FilePath);
+
+		if (FileTime > LatestTime)
+		{
+			LatestTime = FileTime;
+			Latest = FilePath;
+		}
+	}
+
+	return Latest;
+}
+
+void FT66GhostRun::PruneGhostFiles(const FString& LevelName, int32 MaxFiles)
+{
+	if (LevelName.IsEmpty() || MaxFiles <= 0)
+	{
+		return;
+	}
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(GetGhostDir() / LevelName + TEXT("-*") + T66Ghost::FileExtension), true, false);
+
+	// the glob also matches levels that start with this level's name
+	FileNames.RemoveAll([&LevelName](const FString& FileName) { return !T66Ghost::IsGhostFileForLevel(FileName, LevelName); });
+
+	if (FileNames.Num() <= MaxFiles)
+	{
+		return;
+	}
+
+	// newest first
+	TArray<TPair<FDateTime, FString>> Files;
+
+	for (const FString& FileName : FileNames)
+	{
+		const FString FilePath = GetGhostDir() / FileName;
+		Files.Emplace(IFileManager::Get().GetTimeStamp(*FilePath), FilePath);
+	}
+
+	Files.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B) { return A.Key > B.Key; });
+
+	for (int32 Index = MaxFiles; Index < Files.Num(); ++Index)
+	{
+		if (IFileManager::Get().Delete(*Files[Index].Value, false, false, true))
+		{
+			UE_LOG(LogT66, Verbose, TEXT("Pruned ghost run %s"), *Files[Index].Value);
+		}
+	}
+}
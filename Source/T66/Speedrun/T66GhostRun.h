@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ *  A single recorded ghost sample
+ */
+struct FT66GhostFrame
+{
+	/** Time since the start of the run, in milliseconds */
+	uint32 TimeMs = 0;
+
+	/** Character location, quantized to centimeters */
+	FIntVector Location = FIntVector::ZeroValue;
+
+	/** Character yaw, quantized to 1/65536 of a turn */
+	uint16 Yaw = 0;
+
+	/** Character movement mode (EMovementMode, custom modes are offset by MOVE_MAX) */
+	uint8 MovementMode = 0;
+};
+
+/**
+ *  A movement ability performed during the run
+ */
+struct FT66GhostEvent
+{
+	/** Time since the start of the run, in milliseconds */
+	uint32 TimeMs = 0;
+
+	/** Ability performed (ET66MovementAbility) */
+	uint8 Ability = 0;
+};
+
+/**
+ *  A recorded run: transforms, movement modes and ability events.
+ *  Serialized as a compact stream: header, then frames and events delta encoded as zigzag varints.
+ */
+struct FT66GhostRun
+{
+	/** Name of the level the run was recorded in */
+	FString LevelName;
+
+	/** Sampling rate the run was recorded at */
+	uint16 SampleRate = 30;
+
+	/** Total run time in milliseconds */
+	uint32 TotalTimeMs = 0;
+
+	/** Recorded samples, in time order */
+	TArray<FT66GhostFrame> Frames;
+
+	/** Recorded ability events, in time order */
+	TArray<FT66GhostEvent> Events;
+
+public:
+
+	/** Quantizes a world location */
+	static FIntVector QuantizeLocation(const FVector& Location);
+
+	/** Quantizes a yaw angle in degrees */
+	static uint16 QuantizeYaw(float YawDegrees);
+
+	/** Returns the world location for a quantized location */
+	static FVector DequantizeLocation(const FIntVector& Location);
+
+	/** Returns the yaw angle in degrees for a quantized yaw */
+	static float DequantizeYaw(uint16 Yaw);
+
+	/** Serializes the run into the compact stream format */
+	void Encode(TArray<uint8>& OutBytes) const;
+
+	/** Deserializes a run from the compact stream format. Returns false if the data is invalid */
+	bool Decode(const TArray<uint8>& Bytes);
+
+	/** Samples the run at the given time, interpolating between frames. Cursor speeds up forward playback */
+	bool Sample(float TimeSeconds, FVector& OutLocation, FRotator& OutRotation, uint8& OutMovementMode, int32& InOutCursor) const;
+
+	/** Encodes the run and writes it to disk on a background thread. If MaxFilesPerLevel > 0, older files of the level are pruned after the write */
+	void SaveAsync(const FString& FilePath, int32 MaxFilesPerLevel = 0) const;
+
+	/** Loads and decodes a run from disk. Returns false if the file is missing or invalid */
+	static bool LoadFromFile(const FString& FilePath, FT66GhostRun& OutRun);
+
+	/** Returns the directory ghost runs are saved to */
+	static FString GetGhostDir();
+
+	/** Returns a new, timestamped ghost file path for the given level */
+	static FString MakeGhostFilePath(const FString& LevelName);
+
+	/** Returns the newest ghost file in the ghost directory, optionally for a given level */
+	static FString FindLatestGhostFile(const FString& LevelName = FString());
+
+	/** Deletes the oldest ghost files of a level until at most MaxFiles are left */
+	static void PruneGhostFiles(const FString& LevelName, int32 MaxFiles);
+};
@@ -0,0 +1,350 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "T66RunTimerSubsystem.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "T66.h"
+
+namespace T66RunTimer
+{
+	/** File signature */
+	constexpr uint32 Magic = 0x53363654; // 'T66S'
+
+	/** Format version. Bump when the record layout changes */
+	constexpr uint32 Version = 1;
+
+	/** Display precision, bound to t66.Speedrun.DisplayPrecisionMs */
+	int32 DisplayPrecisionMs = 10;
+
+	/** Auto start toggle, bound to t66.Speedrun.AutoStart */
+	bool bAutoStart = true;
+
+	static FAutoConsoleVariableRef CVarDisplayPrecisionMs(
+		TEXT("t66.Speedrun.DisplayPrecisionMs"),
+		DisplayPrecisionMs,
+		TEXT("Precision of the speedrun timer display in milliseconds. The timer text is only rebuilt when it changes at this precision."),
+		ECVF_Default
+	);
+
+	static FAutoConsoleVariableRef CVarAutoStart(
+		TEXT("t66.Speedrun.AutoStart"),
+		bAutoStart,
+		TEXT("If true, the speedrun timer starts automatically when play begins."),
+		ECVF_Default
+	);
+
+	/** Converts a world time span in seconds to microseconds */
+	int64 SecondsToUs(double Seconds)
+	{
+		return static_cast<int64>(FMath::RoundToDouble(Seconds * 1000000.0));
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FT66RunSplit& Split)
+{
+	Ar << Split.Name;
+	Ar << Split.RunTimeUs;
+	Ar << Split.SegmentTimeUs;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FT66RunRecord& Record)
+{
+	uint32 Magic = T66RunTimer::Magic;
+	uint32 Version = T66RunTimer::Version;
+
+	Ar << Magic;
+	Ar << Version;
+
+	// reject files we don't understand
+	if (Ar.IsLoading() && (Magic != T66RunTimer::Magic || Version != T66RunTimer::Version))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	Ar << Record.BestTotalTimeUs;
+	Ar << Record.BestRunSplits;
+	Ar << Record.BestSegmentTimesUs;
+	return Ar;
+}
+
+int64 FT66RunRecord::FindBestRunTime(FName SplitName) const
+{
+	const FT66RunSplit* Split = BestRunSplits.FindByPredicate([SplitName](const FT66RunSplit& Candidate) { return Candidate.Name == SplitName; });
+	return Split ? Split->RunTimeUs : -1;
+}
+
+void UT66RunTimerSubsystem::StartRun()
+{
+	StartWorldTime = GetWorld()->GetTimeSeconds();
+	PausedTimeUs = 0;
+	FinishedTimeUs = 0;
+	Splits.Reset();
+
+	SetState(ET66RunTimerState::Running);
+	UpdateTimerText(true);
+}
+
+void UT66RunTimerSubsystem::PauseRun()
+{
+	if (State != ET66RunTimerState::Running)
+	{
+		return;
+	}
+
+	PauseWorldTime = GetWorld()->GetTimeSeconds();
+	SetState(ET66RunTimerState::Paused);
+}
+
+void UT66RunTimerSubsystem::ResumeRun()
+{
+	if (State != ET66RunTimerState::Paused)
+	{
+		return;
+	}
+
+	PausedTimeUs += T66RunTimer::SecondsToUs(GetWorld()->GetTimeSeconds() - PauseWorldTime);
+	SetState(ET66RunTimerState::Running);
+}
+
+void UT66RunTimerSubsystem::ReachSplit(FName SplitName, bool bFinalSplit)
+{
+	if (State != ET66RunTimerState::Running || SplitName.IsNone())
+	{
+		return;
+	}
+
+	// each split point counts once per run
+	if (Splits.ContainsByPredicate([SplitName](const FT66RunSplit& Split) { return Split.Name == SplitName; }))
+	{
+		return;
+	}
+
+	FT66RunSplit& Split = Splits.AddDefaulted_GetRef();
+	Split.Name = SplitName;
+	Split.RunTimeUs = GetRunTimeUs();
+	Split.SegmentTimeUs = Split.RunTimeUs - (Splits.Num() > 1 ? Splits[Splits.Num() - 2].RunTimeUs : 0);
+
+	// compare against the personal best run
+	const int64 BestRunTimeUs = Record.FindBestRunTime(SplitName);
+	const int64 DeltaUs = BestRunTimeUs >= 0 ? Split.RunTimeUs - BestRunTimeUs : 0;
+
+	OnSplit.Broadcast(Split, DeltaUs);
+
+	if (bFinalSplit)
+	{
+		FinishRun();
+	}
+}
+
+void UT66RunTimerSubsystem::FinishRun()
+{
+	if (State != ET66RunTimerState::Running && State != ET66RunTimerState::Paused)
+	{
+		return;
+	}
+
+	// a paused run's time is already frozen at the pause, so it needs no folding
+	// (going through ResumeRun would broadcast a spurious Running state)
+	FinishedTimeUs = GetRunTimeUs();
+	SetState(ET66RunTimerState::Finished);
+	UpdateTimerText(true);
+
+	bool bRecordChanged = false;
+
+	// update the best segments
+	for (const FT66RunSplit& Split : Splits)
+	{
+		int64& BestSegmentUs = Record.BestSegmentTimesUs.FindOrAdd(Split.Name, TNumericLimits<int64>::Max());
+
+		if (Split.SegmentTimeUs < BestSegmentUs)
+		{
+			BestSegmentUs = Split.SegmentTimeUs;
+			bRecordChanged = true;
+		}
+	}
+
+	// update the personal best
+	if (Record.BestTotalTimeUs == 0 || FinishedTimeUs < Record.BestTotalTimeUs)
+	{
+		Record.BestTotalTimeUs = FinishedTimeUs;
+		Record.BestRunSplits = Splits;
+		bRecordChanged = true;
+
+		UE_LOG(LogT66, Display, TEXT("New personal best for %s: %s"), *LevelName, *FormatTime(FinishedTimeUs, 1).ToString());
+	}
+
+	if (bRecordChanged)
+	{
+		SaveRecord();
+	}
+}
+
+int64 UT66RunTimerSubsystem::GetRunTimeUs() const
+{
+	switch (State)
+	{
+	case ET66RunTimerState::Running:
+		return T66RunTimer::SecondsToUs(GetWorld()->GetTimeSeconds() - StartWorldTime) - PausedTimeUs;
+
+	case ET66RunTimerState::Paused:
+		return T66RunTimer::SecondsToUs(PauseWorldTime - StartWorldTime) - PausedTimeUs;
+
+	case ET66RunTimerState::Finished:
+		return FinishedTimeUs;
+
+	default:
+		return 0;
+	}
+}
+
+FText UT66RunTimerSubsystem::FormatTime(int64 TimeUs, int32 PrecisionMs)
+{
+	const bool bNegative = TimeUs < 0;
+	const int64 TotalMs = FMath::Abs(TimeUs) / 1000;
+
+	const int64 Minutes = TotalMs / 60000;
+	const int64 Seconds = (TotalMs / 1000) % 60;
+	const int64 Millis = TotalMs % 1000;
+
+	const TCHAR* Sign = bNegative ? TEXT("-") : TEXT("");
+
+	// show as many fraction digits as the precision needs
+	FString Text;
+
+	if (PrecisionMs >= 1000)
+	{
+		Text = FString::Printf(TEXT("%s%lld:%02lld"), Sign, Minutes, Seconds);
+	}
+	else if (PrecisionMs >= 100)
+	{
+		Text = FString::Printf(TEXT("%s%lld:%02lld.%01lld"), Sign, Minutes, Seconds, Millis / 100);
+	}
+	else if (PrecisionMs >= 10)
+	{
+		Text = FString::Printf(TEXT("%s%lld:%02lld.%02lld"), Sign, Minutes, Seconds, Millis / 10);
+	}
+	else
+	{
+		Text = FString::Printf(TEXT("%s%lld:%02lld.%03lld"), Sign, Minutes, Seconds, Millis);
+	}
+
+	return FText::FromString(MoveTemp(Text));
+}
+
+int32 UT66RunTimerSubsystem::GetDisplayPrecisionMs()
+{
+	return FMath::Max(1, T66RunTimer::DisplayPrecisionMs);
+}
+
+bool UT66RunTimerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// only time game worlds
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UT66RunTimerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	LevelName = InWorld.GetMapName();
+	LevelName.RemoveFromStart(InWorld.StreamingLevelsPrefix);
+
+	LoadRecord();
+
+	if (T66RunTimer::bAutoStart)
+	{
+		StartRun();
+	}
+}
+
+void UT66RunTimerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (State == ET66RunTimerState::Running)
+	{
+		UpdateTimerText();
+	}
+}
+
+TStatId UT66RunTimerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UT66RunTimerSubsystem, STATGROUP_Tickables);
+}
+
+void UT66RunTimerSubsystem::SetState(ET66RunTimerState NewState)
+{
+	if (State != NewState)
+	{
+		State = NewState;
+		OnStateChanged.Broadcast(State);
+	}
+}
+
+void UT66RunTimerSubsystem::UpdateTimerText(bool bForce)
+{
+	const int32 PrecisionMs = GetDisplayPrecisionMs();
+	const int64 DisplayedUnits = GetRunTimeUs() / (PrecisionMs * 1000);
+
+	// only rebuild the text when the displayed value changes
+	if (!bForce && DisplayedUnits == LastDisplayedUnits)
+	{
+		return;
+	}
+
+	LastDisplayedUnits = DisplayedUnits;
+	TimerText = FormatTime(DisplayedUnits * PrecisionMs * 1000, PrecisionMs);
+
+	OnTimerTextChanged.Broadcast(TimerText);
+}
+
+FString UT66RunTimerSubsystem::GetRecordFilePath() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("Speedrun") / LevelName + TEXT(".t66splits");
+}
+
+void UT66RunTimerSubsystem::LoadRecord()
+{
+	Record = FT66RunRecord();
+
+	TArray<uint8> Bytes;
+
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetRecordFilePath(), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(Bytes);
+	Reader << Record;
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogT66, Warning, TEXT("Ignoring invalid speedrun record %s"), *GetRecordFilePath());
+		Record = FT66RunRecord();
+	}
+}
+
+void UT66RunTimerSubsystem::SaveRecord() const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << const_cast<FT66RunRecord&>(Record);
+
+	// write off the game thread
+	Async(EAsyncExecution::ThreadPool, [Bytes = MoveTemp(Bytes), FilePath = GetRecordFilePath()]()
+	{
+		if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+		{
+			UE_LOG(LogT66, Error, TEXT("Could not write speedrun record to %s"), *FilePath);
+		}
+	});
+}
@@ -0,0 +1,198 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "T66RunTimerSubsystem.generated.h"
+
+/**
+ *  Run timer state
+ */
+UENUM(BlueprintType)
+enum class ET66RunTimerState : uint8
+{
+	Idle,
+	Running,
+	Paused,
+	Finished,
+};
+
+/**
+ *  A split reached during a run, or a personal best split
+ */
+USTRUCT(BlueprintType)
+struct FT66RunSplit
+{
+	GENERATED_BODY()
+
+	/** Split point name */
+	UPROPERTY(BlueprintReadOnly, Category="Speedrun")
+	FName Name;
+
+	/** Run time when the split was reached, in microseconds */
+	int64 RunTimeUs = 0;
+
+	/** Time since the previous split, in microseconds */
+	int64 SegmentTimeUs = 0;
+};
+
+/**
+ *  Personal best times for a level. Persisted as a small binary file in Saved/Speedrun
+ */
+struct FT66RunRecord
+{
+	/** Splits of the personal best run */
+	TArray<FT66RunSplit> BestRunSplits;
+
+	/** Best segment time ever for each split, by split name */
+	TMap<FName, int64> BestSegmentTimesUs;
+
+	/** Personal best total time, in microseconds. Zero if there's no finished run */
+	int64 BestTotalTimeUs = 0;
+
+	/** Serializes the record */
+	friend FArchive& operator<<(FArchive& Ar, FT66RunRecord& Record);
+
+	/** Returns the personal best run time for a split, or -1 if it's not part of the personal best */
+	int64 FindBestRunTime(FName SplitName) const;
+};
+
+/** Called when the displayed timer text changes */
+DECLARE_MULTICAST_DELEGATE_OneParam(FT66OnRunTimerTextChanged, const FText& /*TimerText*/);
+
+/** Called when a split is reached. DeltaUs is the difference to the personal best, or zero if there's none */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FT66OnRunSplit, const FT66RunSplit& /*Split*/, int64 /*DeltaUs*/);
+
+/** Called when the run timer changes state */
+DECLARE_MULTICAST_DELEGATE_OneParam(FT66OnRunTimerStateChanged, ET66RunTimerState /*State*/);
+
+/**
+ *  Native speedrun timer.
+ *  - Time comes from the world's game clock, so it stops with the game and follows time dilation
+ *  - Explicit pauses (menus that don't pause the game) are accounted for separately
+ *  - Times are kept as integer microseconds
+ *  - Split points are reached from gameplay volumes by name
+ *  - Personal bests and best segments are saved per level
+ *  The displayed text is only rebuilt when it changes at display precision (t66.Speedrun.DisplayPrecisionMs).
+ */
+UCLASS()
+class UT66RunTimerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/** Current timer state */
+	ET66RunTimerState State = ET66RunTimerState::Idle;
+
+	/** World time when the run started */
+	double StartWorldTime = 0.0;
+
+	/** World time when the current pause started */
+	double PauseWorldTime = 0.0;
+
+	/** Accumulated paused time, in microseconds */
+	int64 PausedTimeUs = 0;
+
+	/** Total time of a finished run, in microseconds */
+	int64 FinishedTimeUs = 0;
+
+	/** Splits reached in the current run */
+	TArray<FT66RunSplit> Splits;
+
+	/** Personal bests for the current level */
+	FT66RunRecord Record;
+
+	/** Level the record belongs to */
+	FString LevelName;
+
+	/** Last displayed time, in display precision units */
+	int64 LastDisplayedUnits = -1;
+
+	/** Last displayed timer text */
+	FText TimerText;
+
+public:
+
+	/** Called when the displayed timer text changes */
+	FT66OnRunTimerTextChanged OnTimerTextChanged;
+
+	/** Called when a split is reached */
+	FT66OnRunSplit OnSplit;
+
+	/** Called when the timer changes state */
+	FT66OnRunTimerStateChanged OnStateChanged;
+
+public:
+
+	/** Starts a new run, discarding the current one */
+	UFUNCTION(BlueprintCallable, Category="Speedrun")
+	void StartRun();
+
+	/** Pauses the timer without pausing the game */
+	UFUNCTION(BlueprintCallable, Category="Speedrun")
+	void PauseRun();
+
+	/** Resumes an explicitly paused timer */
+	UFUNCTION(BlueprintCallable, Category="Speedrun")
+	void ResumeRun();
+
+	/** Records a split. Each split point counts once per run. Final splits also finish the run */
+	UFUNCTION(BlueprintCallable, Category="Speedrun")
+	void ReachSplit(FName SplitName, bool bFinalSplit = false);
+
+	/** Finishes the run, saving new personal bests */
+	UFUNCTION(BlueprintCallable, Category="Speedrun")
+	void FinishRun();
+
+	/** Returns the timer state */
+	UFUNCTION(BlueprintPure, Category="Speedrun")
+	ET66RunTimerState GetState() const { return State; }
+
+	/** Returns the current run time in seconds */
+	UFUNCTION(BlueprintPure, Category="Speedrun")
+	double GetRunTimeSeconds() const { return GetRunTimeUs() / 1000000.0; }
+
+	/** Returns the current run time in microseconds */
+	int64 GetRunTimeUs() const;
+
+	/** Returns the splits reached so far */
+	const TArray<FT66RunSplit>& GetSplits() const { return Splits; }
+
+	/** Returns the personal bests for the current level */
+	const FT66RunRecord& GetRecord() const { return Record; }
+
+	/** Returns the current timer text */
+	const FText& GetTimerText() const { return TimerText; }
+
+	/** Formats a time in microseconds for display, e.g. 1:23.45 */
+	static FText FormatTime(int64 TimeUs, int32 PrecisionMs);
+
+	/** Returns the display precision in milliseconds */
+	static int32 GetDisplayPrecisionMs();
+
+public:
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Switches the timer state and notifies listeners */
+	void SetState(ET66RunTimerState NewState);
+
+	/** Rebuilds the timer text if the displayed value changed */
+	void UpdateTimerText(bool bForce = false);
+
+	/** Returns the path of the record file for the current level */
+	FString GetRecordFilePath() const;
+
+	/** Loads the personal bests for the current level */
+	void LoadRecord();
+
+	/** Saves the personal bests for the current level on a background thread */
+	void SaveRecord() const;
+};
@@ -20,6 +20,8 @@ public class T66 : ModuleRules
             "GameplayStateTreeModule",
             "GameplayTags",
             "UMG",
+            "ModelViewViewModel",
+            "FieldNotification",
             "Slate",
             "SlateCore" // ✅ REQUIRED for FMargin (fixes linker error)
         });
@@ -32,6 +34,11 @@ public class T66 : ModuleRules
 
             // ✅ Correct path (relative to Source/T66)
             "T66/UI/Registry",
+            "T66/UI/ViewModels",
+
+            "T66/Instrumentation",
+            "T66/Movement",
+            "T66/Speedrun",
 
             "T66/Variant_Platforming",
             "T66/Variant_Platforming/Animation",
@@ -43,8 +50,10 @@ public class T66 : ModuleRules
             "T66/Variant_Combat/UI",
             "T66/Variant_SideScrolling",
             "T66/Variant_SideScrolling/AI",
+            "T66/Variant_SideScrolling/Camera",
             "T66/Variant_SideScrolling/Gameplay",
             "T66/Variant_SideScrolling/Interfaces",
+            "T66/Variant_SideScrolling/Streaming",
             "T66/Variant_SideScrolling/UI"
         });
     }
@@ -5,7 +5,11 @@
 #include "Engine/LocalPlayer.h"
 #include "InputMappingContext.h"
 #include "Blueprint/UserWidget.h"
+#include "Engine/GameInstance.h"
+#include "UI/Shell/T66UIShellSubsystem.h"
 #include "T66.h"
+#include "T66InputLatency.h"
+#include "InputKeyEventArgs.h"
 #include "Widgets/Input/SVirtualJoystick.h"
 
 void AT66PlayerController::BeginPlay()
@@ -75,6 +79,17 @@ void AT66PlayerController::SetupInputComponent()
 	}
 }
 
+bool AT66PlayerController::InputKey(const FInputKeyEventArgs& Params)
+{
+	// timestamp key presses so we can measure how long they take to become visible actions
+	if (Params.Event == IE_Pressed)
+	{
+		FT66InputLatency::NotifyInputArrived(this);
+	}
+
+	return Super::InputKey(Params);
+}
+
 bool AT66PlayerController::ShouldUseTouchControls() const
 {
 	// Are we on a mobile platform? Should we force touch?
@@ -88,21 +103,20 @@ void AT66PlayerController::CreateUIRootIfNeeded()
 		return; // already created
 	}
 
-	if (!UIRootWidgetClass)
+	UT66UIShellSubsystem* Shell = GetGameInstance() ? GetGameInstance()->GetSubsystem<UT66UIShellSubsystem>() : nullptr;
+	if (!Shell)
 	{
-		UE_LOG(LogT66, Warning, TEXT("UIRootWidgetClass is not set. UI Root will not spawn."));
+		UE_LOG(LogT66, Error, TEXT("UT66UIShellSubsystem is missing. UI Root will not spawn."));
 		return;
 	}
 
-	UIRootWidget = CreateWidget<UUserWidget>(this, UIRootWidgetClass);
-	if (!UIRootWidget)
+	// the shell is the only root authority, creating one here would double the UI tree
+	UClass* ShellRootClass = Shell->GetUIRootClass();
+	if (UIRootWidgetClass && ShellRootClass && UIRootWidgetClass != ShellRootClass)
 	{
-		UE_LOG(LogT66, Error, TEXT("Failed to create UI Root widget instance."));
-		return;
+		UE_LOG(LogT66, Warning, TEXT("UIRootWidgetClass %s is ignored: UT66UIShellSubsystem owns the UI root (%s)."), *GetNameSafe(UIRootWidgetClass), *GetNameSafe(ShellRootClass));
 	}
 
-	// ZOrder 0 = base UI layer
-	UIRootWidget->AddToPlayerScreen(0);
-
-	UE_LOG(LogT66, Display, TEXT("Spawned UI Root: %s"), *GetNameSafe(UIRootWidget));
+	// null while the shell is still preloading, it attaches the root itself once ready
+	UIRootWidget = Shell->EnsureUIRootForPlayer(GetLocalPlayer());
 }
@@ -7,6 +7,7 @@
 #include "T66PlayerController.generated.h"
 
 class UInputMappingContext;
+struct FInputKeyEventArgs;
 class UUserWidget;
 
 /**
@@ -40,11 +41,14 @@ protected:
 	UPROPERTY(EditAnywhere, Config, Category = "Input|Touch Controls")
 	bool bForceTouchControls = false;
 
-	/** Root UI widget (Canvas -> Overlay -> NamedSlots) */
+	/**
+	 *  Root UI widget (Canvas -> Overlay -> NamedSlots).
+	 *  Deprecated: UT66UIShellSubsystem owns the root and creates exactly one per local player. Only used to warn on mismatches.
+	 */
 	UPROPERTY(EditAnywhere, Category = "UI|Root")
 	TSubclassOf<UUserWidget> UIRootWidgetClass;
 
-	/** Instance of the root UI widget */
+	/** This player's root UI widget, owned by UT66UIShellSubsystem (null while the shell is still preloading it) */
 	UPROPERTY()
 	TObjectPtr<UUserWidget> UIRootWidget;
 
@@ -54,12 +58,15 @@ protected:
 	/** Input mapping context setup */
 	virtual void SetupInputComponent() override;
 
+	/** Timestamps key presses for the input latency instrumentation */
+	virtual bool InputKey(const FInputKeyEventArgs& Params) override;
+
 	/** Returns true if the player should use UMG touch controls */
 	bool ShouldUseTouchControls() const;
 
 private:
 
-	/** Creates the root UI once for the local player */
+	/** Asks the UI shell for this local player's root UI (the shell never creates a second one) */
 	void CreateUIRootIfNeeded();
 
 };
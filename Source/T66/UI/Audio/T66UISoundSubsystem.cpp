@@ -0,0 +1,289 @@
+#include "UI/Audio/T66UISoundSubsystem.h"
+
+#include "UI/Theme/T66UIThemeSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/PlatformTime.h"
+#include "Sound/SoundBase.h"
+
+void UT66UISoundSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Sound tokens come from the compiled theme
+	Theme = Collection.InitializeDependency<UT66UIThemeSubsystem>();
+
+	if (Theme)
+	{
+		Theme->OnThemeChanged.AddDynamic(this, &UT66UISoundSubsystem::HandleThemeChanged);
+	}
+
+	// Groups are (re)streamed whenever the theme compiles, so these work even before the theme assets are in
+	for (const FName& GroupName : StartupSoundGroups)
+	{
+		LoadSoundGroup(GroupName);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UISoundSubsystem] Initialized"));
+}
+
+void UT66UISoundSubsystem::Deinitialize()
+{
+	if (Theme)
+	{
+		Theme->OnThemeChanged.RemoveDynamic(this, &UT66UISoundSubsystem::HandleThemeChanged);
+		Theme = nullptr;
+	}
+
+	for (FVoice& Voice : Voices)
+	{
+		if (Voice.Component)
+		{
+			Voice.Component->Stop();
+		}
+	}
+
+	Voices.Reset();
+	PoolComponents.Reset();
+	LastPlayTimes.Reset();
+
+	for (TPair<FName, TSharedPtr<FStreamableHandle>>& Group : GroupHandles)
+	{
+		if (Group.Value.IsValid())
+		{
+			Group.Value->ReleaseHandle();
+		}
+	}
+
+	for (TPair<FName, TSharedPtr<FStreamableHandle>>& Token : TokenHandles)
+	{
+		if (Token.Value.IsValid())
+		{
+			Token.Value->ReleaseHandle();
+		}
+	}
+
+	GroupHandles.Reset();
+	TokenHandles.Reset();
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UISoundSubsystem] Deinitialized"));
+
+	Super::Deinitialize();
+}
+
+bool UT66UISoundSubsystem::PlayUISound(FName TokenName)
+{
+	if (!Theme)
+	{
+		return false;
+	}
+
+	const TSoftObjectPtr<USoundBase> SoftSound = Theme->FindSoundToken(TokenName);
+	if (SoftSound.IsNull())
+	{
+		return false;
+	}
+
+	// ✅ Never load on the play path: a late UI sound is worse than a dropped one
+	USoundBase* Sound = SoftSound.Get();
+	if (!Sound)
+	{
+		RequestTokenLoad(TokenName);
+		return false;
+	}
+
+	// Rate limit per token (rapid focus changes fire hover every frame)
+	const double Now = FPlatformTime::Seconds();
+	if (const double* LastPlayTime = LastPlayTimes.Find(TokenName))
+	{
+		if (Now - *LastPlayTime < MinRetriggerInterval)
+		{
+			return false;
+		}
+	}
+
+	if (Voices.Num() == 0)
+	{
+		CreatePool();
+	}
+
+	FVoice* Voice = AcquireVoice(TokenName);
+	if (!Voice || !Voice->Component)
+	{
+		return false;
+	}
+
+	Voice->Component->Stop();
+	Voice->Component->SetSound(Sound);
+	Voice->Component->Play();
+
+	Voice->TokenName = TokenName;
+	Voice->StartTime = Now;
+	LastPlayTimes.Add(TokenName, Now);
+
+	return true;
+}
+
+void UT66UISoundSubsystem::LoadSoundGroup(FName GroupName)
+{
+	if (GroupName.IsNone())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	if (Theme)
+	{
+		Theme->GetSoundGroupPaths(GroupName, Paths);
+	}
+
+	// Request the new set before releasing the old one so shared sounds never unload in between
+	TSharedPtr<FStreamableHandle> NewHandle;
+	if (Paths.Num() > 0)
+	{
+		NewHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+	}
+
+	TSharedPtr<FStreamableHandle>& GroupHandle = GroupHandles.FindOrAdd(GroupName);
+	if (GroupHandle.IsValid())
+	{
+		GroupHandle->ReleaseHandle();
+	}
+
+	// Kept (even empty) so the group is re-streamed when the theme compiles
+	GroupHandle = NewHandle;
+}
+
+void UT66UISoundSubsystem::UnloadSoundGroup(FName GroupName)
+{
+	TSharedPtr<FStreamableHandle> GroupHandle;
+	if (GroupHandles.RemoveAndCopyValue(GroupName, GroupHandle) && GroupHandle.IsValid())
+	{
+		GroupHandle->ReleaseHandle();
+	}
+}
+
+bool UT66UISoundSubsystem::IsSoundGroupLoaded(FName GroupName) const
+{
+	const TSharedPtr<FStreamableHandle>* GroupHandle = GroupHandles.Find(GroupName);
+	return GroupHandle && GroupHandle->IsValid() && (*GroupHandle)->HasLoadCompleted();
+}
+
+void UT66UISoundSubsystem::HandleThemeChanged()
+{
+	// The new theme may point the same tokens at different sounds
+	TArray<FName> LoadedGroups;
+	GroupHandles.GetKeys(LoadedGroups);
+
+	for (const FName& GroupName : LoadedGroups)
+	{
+		LoadSoundGroup(GroupName);
+	}
+
+	for (TPair<FName, TSharedPtr<FStreamableHandle>>& Token : TokenHandles)
+	{
+		if (Token.Value.IsValid())
+		{
+			Token.Value->ReleaseHandle();
+		}
+	}
+
+	TokenHandles.Reset();
+}
+
+void UT66UISoundSubsystem::CreatePool()
+{
+	const int32 NumVoices = FMath::Clamp(PoolSize, 1, 32);
+
+	PoolComponents.Reset(NumVoices);
+	Voices.Reset(NumVoices);
+
+	for (int32 Index = 0; Index < NumVoices; ++Index)
+	{
+		if (UAudioComponent* Component = CreateVoiceComponent())
+		{
+			PoolComponents.Add(Component);
+			Voices.AddDefaulted_GetRef().Component = Component;
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UISoundSubsystem] Created UI audio pool: %d voices"), Voices.Num());
+}
+
+UAudioComponent* UT66UISoundSubsystem::CreateVoiceComponent()
+{
+	// Owned by the GameInstance (not an actor/world) so the pool survives map travel
+	UAudioComponent* Component = NewObject<UAudioComponent>(GetGameInstance());
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	Component->bAutoActivate = false;
+	Component->bAutoDestroy = false;
+	Component->bIsUISound = true;
+	Component->bAllowSpatialization = false;
+	Component->bIgnoreForFlushing = true;
+
+	return Component;
+}
+
+UT66UISoundSubsystem::FVoice* UT66UISoundSubsystem::AcquireVoice(FName TokenName)
+{
+	FVoice* IdleVoice = nullptr;
+	FVoice* OldestSameToken = nullptr;
+	FVoice* OldestAny = nullptr;
+	int32 NumSameToken = 0;
+
+	for (FVoice& Voice : Voices)
+	{
+		if (!Voice.Component || !Voice.Component->IsPlaying())
+		{
+			IdleVoice = IdleVoice ? IdleVoice : &Voice;
+			continue;
+		}
+
+		if (Voice.TokenName == TokenName)
+		{
+			++NumSameToken;
+
+			if (!OldestSameToken || Voice.StartTime < OldestSameToken->StartTime)
+			{
+				OldestSameToken = &Voice;
+			}
+		}
+
+		if (!OldestAny || Voice.StartTime < OldestAny->StartTime)
+		{
+			OldestAny = &Voice;
+		}
+	}
+
+	// Token is at its voice limit: restart its oldest voice instead of stacking another one
+	if (NumSameToken >= FMath::Max(1, MaxVoicesPerToken))
+	{
+		return OldestSameToken;
+	}
+
+	return IdleVoice ? IdleVoice : OldestAny;
+}
+
+void UT66UISoundSubsystem::RequestTokenLoad(FName TokenName)
+{
+	if (!Theme || TokenHandles.Contains(TokenName))
+	{
+		return;
+	}
+
+	const TSoftObjectPtr<USoundBase> SoftSound = Theme->FindSoundToken(TokenName);
+	if (SoftSound.IsNull())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("[T66UISoundSubsystem] %s played before its group was streamed in (dropped, loading now)"), *TokenName.ToString());
+
+	TokenHandles.Add(TokenName, UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftSound.ToSoftObjectPath()));
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "T66UISoundSubsystem.generated.h"
+
+class UAudioComponent;
+class UT66UIThemeSubsystem;
+struct FStreamableHandle;
+
+/**
+ * UT66UISoundSubsystem
+ * - Streams UI sound tokens (UT66UIThemeDA::SoundTokens, soft) in groups: ex "Frontend" at boot, "InRun" when a run starts
+ * - Plays them through a small pre-allocated pool of 2D UI audio components (no sound instance spawned per event)
+ * - Concurrency limits: max voices per token (oldest voice is restarted) + min retrigger interval (drops hover spam)
+ */
+UCLASS(Config = Game)
+class T66_API UT66UISoundSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Plays a sound token (ex: "SFX.UI.Hover"). Returns false if it was dropped (not streamed in, or rate limited).
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Audio")
+	bool PlayUISound(FName TokenName);
+
+	// Streams a sound group in and keeps it resident until UnloadSoundGroup
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Audio")
+	void LoadSoundGroup(FName GroupName);
+
+	// Releases a sound group (sounds still referenced elsewhere stay loaded)
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Audio")
+	void UnloadSoundGroup(FName GroupName);
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Audio")
+	bool IsSoundGroupLoaded(FName GroupName) const;
+
+protected:
+	// Groups streamed in at startup
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Audio")
+	TArray<FName> StartupSoundGroups = { FName(TEXT("Frontend")) };
+
+	// Audio components allocated up front
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Audio", meta = (ClampMin = 1, ClampMax = 32))
+	int32 PoolSize = 6;
+
+	// Max simultaneous voices of the same token
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Audio", meta = (ClampMin = 1))
+	int32 MaxVoicesPerToken = 2;
+
+	// The same token can't play again sooner than this (seconds, real time)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Audio", meta = (ClampMin = 0))
+	float MinRetriggerInterval = 0.04f;
+
+private:
+	// One pooled voice
+	struct FVoice
+	{
+		TObjectPtr<UAudioComponent> Component = nullptr;
+		FName TokenName;
+		double StartTime = 0.0;
+	};
+
+	UFUNCTION()
+	void HandleThemeChanged();
+
+	void CreatePool();
+	UAudioComponent* CreateVoiceComponent();
+
+	// Picks the voice to play a token on (idle first, then the oldest voice of the same token, then the oldest overall)
+	FVoice* AcquireVoice(FName TokenName);
+
+	// Streams a single token that was played before its group was loaded (so the next play works)
+	void RequestTokenLoad(FName TokenName);
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UT66UIThemeSubsystem> Theme = nullptr;
+
+	// Pooled components (kept here so GC sees them; FVoice holds the play bookkeeping)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> PoolComponents;
+
+	TArray<FVoice> Voices;
+
+	// Real time each token last started
+	TMap<FName, double> LastPlayTimes;
+
+	TMap<FName, TSharedPtr<FStreamableHandle>> GroupHandles;
+	TMap<FName, TSharedPtr<FStreamableHandle>> TokenHandles;
+};
@@ -0,0 +1,354 @@
+#include "UI/Focus/T66FocusNavigationGraph.h"
+
+#include "UI/Widgets/T66WidgetBase.h"
+#include "UI/Widgets/T66InteractiveButtonWidgetBase.h"
+#include "Blueprint/WidgetTree.h"
+
+namespace T66FocusNavigation
+{
+	// Misalignment costs this much more than distance along the navigation axis
+	static constexpr float SecondaryAxisWeight = 2.f;
+
+	// Min distance along the navigation axis (slate units) for a control to count as "in that direction"
+	static constexpr float MinPrimaryDistance = 1.f;
+
+	// Size/position change (slate units) that makes the built edges stale
+	static constexpr float GeometryTolerance = 0.5f;
+
+	static EUINavigation GetOppositeDirection(EUINavigation Direction)
+	{
+		switch (Direction)
+		{
+		case EUINavigation::Left:     return EUINavigation::Right;
+		case EUINavigation::Right:    return EUINavigation::Left;
+		case EUINavigation::Up:       return EUINavigation::Down;
+		case EUINavigation::Down:     return EUINavigation::Up;
+		case EUINavigation::Next:     return EUINavigation::Previous;
+		case EUINavigation::Previous: return EUINavigation::Next;
+		default:                      return EUINavigation::Invalid;
+		}
+	}
+
+	static bool IsValidDirection(EUINavigation Direction)
+	{
+		return static_cast<uint8>(Direction) < static_cast<uint8>(EUINavigation::Num);
+	}
+}
+
+void FT66FocusNavigationGraph::Build(UT66WidgetBase& Surface, TConstArrayView<FT66FocusNavEdge> ExplicitEdges)
+{
+	Nodes.Reset();
+	IndexByID.Reset();
+	bDirty = false;
+
+	const FGeometry& SurfaceGeometry = Surface.GetCachedGeometry();
+	BuiltSize = SurfaceGeometry.GetLocalSize();
+	bBuiltWithGeometry = !BuiltSize.IsNearlyZero();
+
+	TArray<UT66InteractiveButtonWidgetBase*> Controls;
+	GatherControls(&Surface, Controls);
+
+	for (UT66InteractiveButtonWidgetBase* Control : Controls)
+	{
+		// Every control reports show/hide to this surface, even the ones left out now
+		Control->FocusNavSurface = &Surface;
+		Control->FocusNavIndex = INDEX_NONE;
+
+		if (!Control->ControlID.IsValid() || !Control->IsVisible())
+		{
+			continue;
+		}
+
+		const FGeometry& ControlGeometry = Control->GetCachedGeometry();
+		if (bBuiltWithGeometry && ControlGeometry.GetLocalSize().IsNearlyZero())
+		{
+			continue;
+		}
+
+		if (IndexByID.Contains(Control->ControlID))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[T66FocusNavigationGraph] %s: ControlID %s is used more than once, only the first one is navigable"),
+				*Surface.GetName(), *Control->ControlID.ToString());
+			continue;
+		}
+
+		// Nothing inside can take keyboard focus (ex: a display-only button style)
+		UWidget* FocusTarget = FindFocusableWidget(Control);
+		if (!FocusTarget)
+		{
+			continue;
+		}
+
+		FNode& Node = Nodes.AddDefaulted_GetRef();
+		Node.Control = Control;
+		Node.FocusTarget = FocusTarget;
+		Node.ControlID = Control->ControlID;
+
+		for (int32& Neighbor : Node.Neighbors)
+		{
+			Neighbor = INDEX_NONE;
+		}
+
+		if (bBuiltWithGeometry)
+		{
+			Node.Center = GetControlCenter(SurfaceGeometry, *Control);
+		}
+
+		Control->FocusNavIndex = Nodes.Num() - 1;
+		IndexByID.Add(Node.ControlID, Control->FocusNavIndex);
+	}
+
+	// Before layout only the ID lookup (DefaultFocusID) is usable; directional edges wait for the rebuild
+	if (bBuiltWithGeometry)
+	{
+		ComputeGeometricEdges();
+	}
+
+	ApplyExplicitEdges(ExplicitEdges);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[T66FocusNavigationGraph] %s: %d controls%s"),
+		*Surface.GetName(), Nodes.Num(), bBuiltWithGeometry ? TEXT("") : TEXT(" (no layout yet)"));
+}
+
+bool FT66FocusNavigationGraph::NeedsRebuild(const UWidget& Surface) const
+{
+	if (bDirty)
+	{
+		return true;
+	}
+
+	const FGeometry& SurfaceGeometry = Surface.GetCachedGeometry();
+	const FVector2D Size = SurfaceGeometry.GetLocalSize();
+
+	if (!bBuiltWithGeometry)
+	{
+		return !Size.IsNearlyZero();
+	}
+
+	if (!Size.Equals(BuiltSize, T66FocusNavigation::GeometryTolerance))
+	{
+		return true;
+	}
+
+	// Scrolling or a relayout moves controls without resizing the surface or telling us
+	for (const FNode& Node : Nodes)
+	{
+		const UT66InteractiveButtonWidgetBase* Control = Node.Control.Get();
+
+		if (!Control || !GetControlCenter(SurfaceGeometry, *Control).Equals(Node.Center, T66FocusNavigation::GeometryTolerance))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FVector2D FT66FocusNavigationGraph::GetControlCenter(const FGeometry& SurfaceGeometry, const UT66InteractiveButtonWidgetBase& Control)
+{
+	return SurfaceGeometry.AbsoluteToLocal(Control.GetCachedGeometry().GetAbsolutePositionAtCoordinates(FVector2D(0.5f, 0.5f)));
+}
+
+UWidget* FT66FocusNavigationGraph::FindNavigationTarget(const UT66InteractiveButtonWidgetBase* Control, EUINavigation Direction, bool& bOutStop) const
+{
+	bOutStop = false;
+
+	const int32 StartIndex = FindNodeIndex(Control);
+	if (StartIndex == INDEX_NONE || !T66FocusNavigation::IsValidDirection(Direction))
+	{
+		return nullptr;
+	}
+
+	// Bounded: a loop of disabled controls ends after one pass
+	int32 Current = StartIndex;
+	for (int32 Step = 0; Step < Nodes.Num(); ++Step)
+	{
+		const int32 Neighbor = Nodes[Current].Neighbors[static_cast<int32>(Direction)];
+
+		if (Neighbor == StopNeighbor)
+		{
+			bOutStop = true;
+			return nullptr;
+		}
+
+		if (Neighbor == INDEX_NONE || Neighbor == StartIndex)
+		{
+			return nullptr;
+		}
+
+		if (IsNavigable(Nodes[Neighbor]))
+		{
+			return Nodes[Neighbor].FocusTarget.Get();
+		}
+
+		Current = Neighbor;
+	}
+
+	return nullptr;
+}
+
+UWidget* FT66FocusNavigationGraph::FindFocusTarget(const FGameplayTag& ControlID) const
+{
+	const int32* Index = IndexByID.Find(ControlID);
+	return (Index && IsNavigable(Nodes[*Index])) ? Nodes[*Index].FocusTarget.Get() : nullptr;
+}
+
+void FT66FocusNavigationGraph::GatherControls(const UUserWidget* Widget, TArray<UT66InteractiveButtonWidgetBase*>& OutControls)
+{
+	if (!Widget || !Widget->WidgetTree)
+	{
+		return;
+	}
+
+	Widget->WidgetTree->ForEachWidget([&OutControls](UWidget* Child)
+	{
+		if (UT66InteractiveButtonWidgetBase* Control = Cast<UT66InteractiveButtonWidgetBase>(Child))
+		{
+			OutControls.Add(Control);
+			return;
+		}
+
+		// Nested surfaces have their own graph
+		const UT66WidgetBase* ChildSurface = Cast<UT66WidgetBase>(Child);
+		if (ChildSurface && ChildSurface->SurfaceType != ET66UISurfaceType::Component)
+		{
+			return;
+		}
+
+		if (const UUserWidget* ChildUserWidget = Cast<UUserWidget>(Child))
+		{
+			GatherControls(ChildUserWidget, OutControls);
+		}
+	});
+}
+
+UWidget* FT66FocusNavigationGraph::FindFocusableWidget(UT66InteractiveButtonWidgetBase* Control)
+{
+	if (UWidget* DesiredFocus = Control->GetDesiredFocusWidget())
+	{
+		return DesiredFocus;
+	}
+
+	if (Control->IsFocusable())
+	{
+		return Control;
+	}
+
+	// Usually the inner UButton
+	UWidget* Focusable = nullptr;
+	if (Control->WidgetTree)
+	{
+		Control->WidgetTree->ForEachWidget([&Focusable](UWidget* Child)
+		{
+			const TSharedPtr<SWidget> SlateWidget = Child->GetCachedWidget();
+			if (!Focusable && SlateWidget.IsValid() && SlateWidget->SupportsKeyboardFocus())
+			{
+				Focusable = Child;
+			}
+		});
+	}
+
+	return Focusable;
+}
+
+bool FT66FocusNavigationGraph::IsNavigable(const FNode& Node)
+{
+	const UT66InteractiveButtonWidgetBase* Control = Node.Control.Get();
+	return Control && Node.FocusTarget.IsValid() && Control->GetIsEnabled() && Control->IsVisible();
+}
+
+void FT66FocusNavigationGraph::ComputeGeometricEdges()
+{
+	static const FVector2D DirectionVectors[] =
+	{
+		FVector2D(-1.f, 0.f),	// Left
+		FVector2D(1.f, 0.f),	// Right
+		FVector2D(0.f, -1.f),	// Up
+		FVector2D(0.f, 1.f),	// Down
+	};
+
+	const int32 NumNodes = Nodes.Num();
+
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		FNode& Node = Nodes[Index];
+
+		for (int32 DirectionIndex = 0; DirectionIndex < UE_ARRAY_COUNT(DirectionVectors); ++DirectionIndex)
+		{
+			const FVector2D& Axis = DirectionVectors[DirectionIndex];
+
+			int32 BestIndex = INDEX_NONE;
+			float BestScore = TNumericLimits<float>::Max();
+
+			for (int32 Other = 0; Other < NumNodes; ++Other)
+			{
+				if (Other == Index)
+				{
+					continue;
+				}
+
+				const FVector2D Delta = Nodes[Other].Center - Node.Center;
+				const float Primary = Delta | Axis;
+				if (Primary < T66FocusNavigation::MinPrimaryDistance)
+				{
+					continue;
+				}
+
+				// Strictly lower: equal scores keep the earlier control in the hierarchy
+				const float Score = Primary + FMath::Abs(Delta ^ Axis) * T66FocusNavigation::SecondaryAxisWeight;
+				if (Score < BestScore)
+				{
+					BestScore = Score;
+					BestIndex = Other;
+				}
+			}
+
+			Node.Neighbors[DirectionIndex] = BestIndex;
+		}
+
+		if (NumNodes > 1)
+		{
+			Node.Neighbors[static_cast<int32>(EUINavigation::Next)] = (Index + 1) % NumNodes;
+			Node.Neighbors[static_cast<int32>(EUINavigation::Previous)] = (Index + NumNodes - 1) % NumNodes;
+		}
+	}
+}
+
+void FT66FocusNavigationGraph::ApplyExplicitEdges(TConstArrayView<FT66FocusNavEdge> ExplicitEdges)
+{
+	for (const FT66FocusNavEdge& Edge : ExplicitEdges)
+	{
+		const int32* FromIndex = IndexByID.Find(Edge.From);
+		if (!FromIndex || !T66FocusNavigation::IsValidDirection(Edge.Direction))
+		{
+			continue;
+		}
+
+		if (!Edge.To.IsValid())
+		{
+			Nodes[*FromIndex].Neighbors[static_cast<int32>(Edge.Direction)] = StopNeighbor;
+			continue;
+		}
+
+		// Target not on screen: keep the computed edge
+		const int32* ToIndex = IndexByID.Find(Edge.To);
+		if (!ToIndex)
+		{
+			continue;
+		}
+
+		Nodes[*FromIndex].Neighbors[static_cast<int32>(Edge.Direction)] = *ToIndex;
+
+		if (Edge.bTwoWay)
+		{
+			Nodes[*ToIndex].Neighbors[static_cast<int32>(T66FocusNavigation::GetOppositeDirection(Edge.Direction))] = *FromIndex;
+		}
+	}
+}
+
+int32 FT66FocusNavigationGraph::FindNodeIndex(const UT66InteractiveButtonWidgetBase* Control) const
+{
+	// The control carries its index; a control from an older build no longer matches
+	const int32 Index = Control ? Control->FocusNavIndex : INDEX_NONE;
+	return (Nodes.IsValidIndex(Index) && Nodes[Index].Control.Get() == Control) ? Index : INDEX_NONE;
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Types/SlateEnums.h"
+#include "T66FocusNavigationGraph.generated.h"
+
+class UWidget;
+class UUserWidget;
+class UT66WidgetBase;
+class UT66InteractiveButtonWidgetBase;
+
+/**
+ * Designer-authored navigation edge between two ControlIDs of the same surface.
+ * Overrides the edge the graph computed from the layout.
+ */
+USTRUCT(BlueprintType)
+struct T66_API FT66FocusNavEdge
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Focus", meta = (Categories = "Focus"))
+	FGameplayTag From;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Focus")
+	EUINavigation Direction = EUINavigation::Down;
+
+	/** Control reached from From. None = navigation stops there (no fallback). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Focus", meta = (Categories = "Focus"))
+	FGameplayTag To;
+
+	/** Also adds the opposite edge (To -> From: Left/Right, Up/Down, Next/Previous). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Focus")
+	bool bTwoWay = false;
+};
+
+/**
+ * FT66FocusNavigationGraph
+ * - Per-surface table of ControlID -> neighbor per direction, owned by UT66WidgetBase
+ * - Built once after layout: every visible UT66InteractiveButtonWidgetBase with a ControlID and something focusable is a node
+ *   (found through the surface's tree and the components in it, not through nested surfaces)
+ * - Left/Right/Up/Down: closest control in that direction, aligned controls first (ties go to hierarchy order)
+ * - Next/Previous: hierarchy order, wrapping
+ * - Explicit edges are applied last and win
+ * A lookup is an index read. The graph is only rebuilt when invalidated (construct, theme/layout change,
+ * a control shown/hidden, surface resized) or when a control moved since (scrolling, relayout, animation).
+ */
+struct T66_API FT66FocusNavigationGraph
+{
+	/** Collects the surface's controls and computes every edge. Uses the surface's cached geometry. */
+	void Build(UT66WidgetBase& Surface, TConstArrayView<FT66FocusNavEdge> ExplicitEdges);
+
+	void Invalidate() { bDirty = true; }
+
+	/**
+	 * True if invalidated, built before layout, or the surface changed size or any control moved since.
+	 * Compares cached geometry only (a few vector compares), so it's cheap enough to run on every navigation.
+	 */
+	bool NeedsRebuild(const UWidget& Surface) const;
+
+	/**
+	 * Widget to focus when navigating from Control in Direction.
+	 * Disabled/hidden targets are skipped (the same direction is followed from them).
+	 * Returns null when there is no edge; bOutStop is set if an explicit edge blocks navigation.
+	 */
+	UWidget* FindNavigationTarget(const UT66InteractiveButtonWidgetBase* Control, EUINavigation Direction, bool& bOutStop) const;
+
+	/** Widget to focus for a ControlID (ex: the surface's DefaultFocusID) */
+	UWidget* FindFocusTarget(const FGameplayTag& ControlID) const;
+
+	int32 Num() const { return Nodes.Num(); }
+
+private:
+	static constexpr int32 NumDirections = static_cast<int32>(EUINavigation::Num);
+
+	// Neighbor value for an explicit "no navigation" edge (INDEX_NONE = no edge, let Slate decide)
+	static constexpr int32 StopNeighbor = -2;
+
+	struct FNode
+	{
+		TWeakObjectPtr<UT66InteractiveButtonWidgetBase> Control;
+
+		// Focusable widget inside the control (its desired focus widget, itself, or its first focusable child)
+		TWeakObjectPtr<UWidget> FocusTarget;
+
+		FGameplayTag ControlID;
+
+		// Center in surface space
+		FVector2D Center = FVector2D::ZeroVector;
+
+		int32 Neighbors[NumDirections];
+	};
+
+	// Controls of Widget's tree, in hierarchy order (descends into components, stops at nested surfaces)
+	static void GatherControls(const UUserWidget* Widget, TArray<UT66InteractiveButtonWidgetBase*>& OutControls);
+
+	// Null if neither the control nor anything in it can take keyboard focus
+	static UWidget* FindFocusableWidget(UT66InteractiveButtonWidgetBase* Control);
+
+	static bool IsNavigable(const FNode& Node);
+
+	// Node's control center in surface space, from the cached geometry
+	static FVector2D GetControlCenter(const FGeometry& SurfaceGeometry, const UT66InteractiveButtonWidgetBase& Control);
+
+	void ComputeGeometricEdges();
+	void ApplyExplicitEdges(TConstArrayView<FT66FocusNavEdge> ExplicitEdges);
+
+	int32 FindNodeIndex(const UT66InteractiveButtonWidgetBase* Control) const;
+
+private:
+	TArray<FNode> Nodes;
+	TMap<FGameplayTag, int32> IndexByID;
+
+	// Surface size the edges were computed for
+	FVector2D BuiltSize = FVector2D::ZeroVector;
+
+	bool bBuiltWithGeometry = false;
+	bool bDirty = true;
+};
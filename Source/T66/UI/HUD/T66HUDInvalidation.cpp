@@ -0,0 +1,246 @@
+#include "UI/HUD/T66HUDInvalidation.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/InvalidationBox.h"
+#include "Components/RetainerBox.h"
+#include "Debugging/SlateDebugging.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Types/ReflectionMetadata.h"
+
+namespace T66HUDInvalidation
+{
+	/** Invalidation boxes cache, bound to t66.HUD.Invalidation */
+	bool bEnableInvalidation = true;
+
+	/** Low-rate retainer rendering, bound to t66.HUD.RetainerMode */
+	int32 RetainerMode = 0;
+
+	/** Frames between two redraws of a retained panel, bound to t66.HUD.RetainerPhases */
+	int32 RetainerPhases = 4;
+
+	/** Per-frame invalidation report, bound to t66.HUD.ShowInvalidations */
+	bool bShowInvalidations = false;
+
+	static const FString VolatilePrefix(TEXT("Volatile_"));
+	static const FString RetainedPrefix(TEXT("Retained_"));
+
+	/** Replaces the previous frame's on-screen report instead of stacking lines */
+	static constexpr int32 OnScreenMessageKey = 6648;
+
+	/** A constructed HUD widget and the bound widgets it keeps volatile */
+	struct FRegisteredWidget
+	{
+		TWeakObjectPtr<UUserWidget> Widget;
+		TArray<TWeakObjectPtr<UWidget>> VolatileWidgets;
+	};
+
+	/** HUD widgets currently constructed */
+	TArray<FRegisteredWidget> RegisteredWidgets;
+
+#if WITH_SLATE_DEBUGGING
+	/** Invalidations seen this frame, by HUD widget name */
+	TMap<FString, int32> FrameInvalidations;
+
+	FDelegateHandle InvalidateHandle;
+	FDelegateHandle EndFrameHandle;
+
+	static void HandleWidgetInvalidated(const FSlateDebuggingInvalidateArgs& Args)
+	{
+		const SWidget* Invalidated = Args.WidgetInvalidated;
+		if (!Invalidated)
+		{
+			return;
+		}
+
+		// Only report widgets under a registered HUD root (debug only, a parent walk is fine)
+		for (const FRegisteredWidget& Registered : RegisteredWidgets)
+		{
+			const UUserWidget* Widget = Registered.Widget.Get();
+			const TSharedPtr<SWidget> Root = Widget ? Widget->GetCachedWidget() : nullptr;
+			if (!Root.IsValid())
+			{
+				continue;
+			}
+
+			for (const SWidget* Current = Invalidated; Current; Current = Current->GetParentWidget().Get())
+			{
+				if (Current == Root.Get())
+				{
+					const FString Name = FString::Printf(TEXT("%s/%s"), *Widget->GetName(), *FReflectionMetaData::GetWidgetDebugInfo(Invalidated));
+					++FrameInvalidations.FindOrAdd(Name);
+					return;
+				}
+			}
+		}
+	}
+
+	static void HandleEndFrame()
+	{
+		if (FrameInvalidations.Num() == 0)
+		{
+			return;
+		}
+
+		FString Report;
+		for (const TPair<FString, int32>& Invalidation : FrameInvalidations)
+		{
+			Report += FString::Printf(TEXT("%s x%d  "), *Invalidation.Key, Invalidation.Value);
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("[T66HUDInvalidation] Frame %llu: %s"), GFrameCounter, *Report);
+
+		if (GEngine)
+		{
+			GEngine->AddOnScreenDebugMessage(OnScreenMessageKey, 0.f, FColor::Orange,
+				FString::Printf(TEXT("HUD invalidations: %s"), *Report));
+		}
+
+		FrameInvalidations.Reset();
+	}
+#endif
+
+	static void Apply(const FRegisteredWidget& Registered)
+	{
+		UUserWidget* Widget = Registered.Widget.Get();
+		if (!Widget || !Widget->WidgetTree)
+		{
+			return;
+		}
+
+		for (const TWeakObjectPtr<UWidget>& VolatileWidget : Registered.VolatileWidgets)
+		{
+			if (UWidget* Child = VolatileWidget.Get())
+			{
+				Child->ForceVolatile(bEnableInvalidation);
+			}
+		}
+
+		const int32 NumPhases = FMath::Max(1, RetainerPhases);
+		int32 NextPhase = 0;
+
+		Widget->WidgetTree->ForEachWidget([&NextPhase, NumPhases](UWidget* Child)
+		{
+			if (UInvalidationBox* InvalidationBox = Cast<UInvalidationBox>(Child))
+			{
+				InvalidationBox->SetCanCache(bEnableInvalidation);
+			}
+			else if (URetainerBox* RetainerBox = Cast<URetainerBox>(Child))
+			{
+				// Only opted-in panels: other retainers (ex: effect retainers) keep their authored settings.
+				// Spread them over the phases so two retained panels never redraw in the same frame
+				if (RetainerBox->GetName().StartsWith(RetainedPrefix))
+				{
+					RetainerBox->SetRetainRendering(RetainerMode > 0);
+					RetainerBox->SetRenderingPhase(NextPhase++ % NumPhases, NumPhases);
+				}
+			}
+
+			if (Child->GetName().StartsWith(VolatilePrefix))
+			{
+				Child->ForceVolatile(bEnableInvalidation);
+			}
+		});
+	}
+
+	static void OnSettingChanged(IConsoleVariable* Variable)
+	{
+		FT66HUDInvalidation::ApplyToAll();
+	}
+
+	static FAutoConsoleVariableRef CVarInvalidation(
+		TEXT("t66.HUD.Invalidation"),
+		bEnableInvalidation,
+		TEXT("If true, invalidation boxes in HUD widgets cache their content and Volatile_* widgets are isolated from them."),
+		FConsoleVariableDelegate::CreateStatic(&OnSettingChanged),
+		ECVF_Default
+	);
+
+	static FAutoConsoleVariableRef CVarRetainerMode(
+		TEXT("t66.HUD.RetainerMode"),
+		RetainerMode,
+		TEXT("0: retainer boxes in HUD widgets render every frame. 1: they render at a low rate (see t66.HUD.RetainerPhases)."),
+		FConsoleVariableDelegate::CreateStatic(&OnSettingChanged),
+		ECVF_Default
+	);
+
+	static FAutoConsoleVariableRef CVarRetainerPhases(
+		TEXT("t66.HUD.RetainerPhases"),
+		RetainerPhases,
+		TEXT("In retainer mode, a retained HUD panel redraws once every this many frames."),
+		FConsoleVariableDelegate::CreateStatic(&OnSettingChanged),
+		ECVF_Default
+	);
+
+	static FAutoConsoleVariableRef CVarShowInvalidations(
+		TEXT("t66.HUD.ShowInvalidations"),
+		bShowInvalidations,
+		TEXT("If true, prints (log + screen) which HUD widgets were invalidated each frame. Requires Slate debugging (non-shipping)."),
+		FConsoleVariableDelegate::CreateStatic(&OnSettingChanged),
+		ECVF_Cheat
+	);
+}
+
+void FT66HUDInvalidation::RegisterHUDWidget(UUserWidget* Widget, TConstArrayView<UWidget*> VolatileWidgets)
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	// Registering again replaces the previous entry
+	UnregisterHUDWidget(Widget);
+
+	T66HUDInvalidation::FRegisteredWidget& Registered = T66HUDInvalidation::RegisteredWidgets.AddDefaulted_GetRef();
+	Registered.Widget = Widget;
+
+	for (UWidget* VolatileWidget : VolatileWidgets)
+	{
+		if (VolatileWidget)
+		{
+			Registered.VolatileWidgets.Add(VolatileWidget);
+		}
+	}
+
+	T66HUDInvalidation::Apply(Registered);
+	UpdateInvalidationDebugging();
+}
+
+void FT66HUDInvalidation::UnregisterHUDWidget(UUserWidget* Widget)
+{
+	T66HUDInvalidation::RegisteredWidgets.RemoveAll([Widget](const T66HUDInvalidation::FRegisteredWidget& Registered) { return !Registered.Widget.IsValid() || Registered.Widget.Get() == Widget; });
+}
+
+void FT66HUDInvalidation::ApplyToAll()
+{
+	for (const T66HUDInvalidation::FRegisteredWidget& Registered : T66HUDInvalidation::RegisteredWidgets)
+	{
+		T66HUDInvalidation::Apply(Registered);
+	}
+
+	UpdateInvalidationDebugging();
+}
+
+void FT66HUDInvalidation::UpdateInvalidationDebugging()
+{
+#if WITH_SLATE_DEBUGGING
+	const bool bWantsDebugging = T66HUDInvalidation::bShowInvalidations;
+	const bool bIsDebugging = T66HUDInvalidation::InvalidateHandle.IsValid();
+
+	if (bWantsDebugging && !bIsDebugging)
+	{
+		T66HUDInvalidation::InvalidateHandle = FSlateDebugging::WidgetInvalidateEvent.AddStatic(&T66HUDInvalidation::HandleWidgetInvalidated);
+		T66HUDInvalidation::EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&T66HUDInvalidation::HandleEndFrame);
+	}
+	else if (!bWantsDebugging && bIsDebugging)
+	{
+		FSlateDebugging::WidgetInvalidateEvent.Remove(T66HUDInvalidation::InvalidateHandle);
+		FCoreDelegates::OnEndFrame.Remove(T66HUDInvalidation::EndFrameHandle);
+		T66HUDInvalidation::InvalidateHandle.Reset();
+		T66HUDInvalidation::EndFrameHandle.Reset();
+		T66HUDInvalidation::FrameInvalidations.Reset();
+	}
+#endif
+}
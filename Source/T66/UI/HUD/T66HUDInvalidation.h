@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UUserWidget;
+class UWidget;
+
+/**
+ * Invalidation / retainer strategy shared by the in-run HUD widgets (WBP_Screen_InRunHUD, WBP_Ov_SpeedrunTimer...).
+ *
+ * Registered HUD widgets get, from their widget tree:
+ * - Every UInvalidationBox caches (static chrome is painted once, until something in it changes)
+ * - Widgets named Volatile_* (or passed as VolatileWidgets) are forced volatile: timers/counters repaint
+ *   on their own without invalidating the cached chrome around them
+ * - URetainerBoxes named Retained_* (minimap, status panels) render at a low rate when t66.HUD.RetainerMode is 1,
+ *   each on its own phase so they never redraw in the same frame. Other retainer boxes (ex: effect
+ *   retainers the designer set up) are left as authored.
+ *
+ * t66.HUD.Invalidation / t66.HUD.RetainerMode are applied live to every registered widget.
+ * t66.HUD.ShowInvalidations 1 prints which HUD widgets were invalidated each frame (non-shipping).
+ */
+struct T66_API FT66HUDInvalidation
+{
+	/**
+	 * Applies the current settings to the widget's tree and tracks it for setting changes + invalidation debugging.
+	 * VolatileWidgets are treated like Volatile_* widgets (for bound widgets whose name can't change).
+	 */
+	static void RegisterHUDWidget(UUserWidget* Widget, TConstArrayView<UWidget*> VolatileWidgets = {});
+
+	static void UnregisterHUDWidget(UUserWidget* Widget);
+
+	/** Re-applies the current settings to every registered widget (called when a t66.HUD.* cvar changes). */
+	static void ApplyToAll();
+
+private:
+	static void UpdateInvalidationDebugging();
+};
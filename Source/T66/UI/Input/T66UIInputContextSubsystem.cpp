@@ -0,0 +1,212 @@
+#include "UI/Input/T66UIInputContextSubsystem.h"
+
+#include "UI/Registry/T66UIInputContextRegistryDA.h"
+#include "EnhancedInputSubsystems.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/StreamableManager.h"
+#include "InputMappingContext.h"
+
+void UT66UIInputContextSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (InputContextRegistry.IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIInputContextSubsystem] No UT66UIInputContextRegistryDA configured (InputContextRegistry in DefaultGame.ini). UI input contexts won't be applied."));
+		return;
+	}
+
+	RegistryHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		InputContextRegistry.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UT66UIInputContextSubsystem::HandleRegistryLoaded),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+}
+
+void UT66UIInputContextSubsystem::Deinitialize()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	if (RegistryHandle.IsValid())
+	{
+		RegistryHandle->CancelHandle();
+		RegistryHandle.Reset();
+	}
+
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+
+	RefCounts.Reset();
+	AppliedContexts.Reset();
+	LoadedRegistry = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UT66UIInputContextSubsystem::PushInputContext(FGameplayTag InputContextTag)
+{
+	if (!InputContextTag.IsValid())
+	{
+		return;
+	}
+
+	++RefCounts.FindOrAdd(InputContextTag);
+	RequestFlush();
+}
+
+void UT66UIInputContextSubsystem::PopInputContext(FGameplayTag InputContextTag)
+{
+	int32* RefCount = RefCounts.Find(InputContextTag);
+	if (!RefCount)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIInputContextSubsystem] Pop without a matching push: %s"), *InputContextTag.ToString());
+		return;
+	}
+
+	if (--(*RefCount) <= 0)
+	{
+		RefCounts.Remove(InputContextTag);
+	}
+
+	RequestFlush();
+}
+
+void UT66UIInputContextSubsystem::FlushInputContexts()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	UEnhancedInputLocalPlayerSubsystem* EnhancedInput = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer());
+	if (!EnhancedInput || !LoadedRegistry)
+	{
+		return;
+	}
+
+	// ✅ Deferred: every add/remove below lands in the same (single) control-mapping rebuild
+	FModifyContextOptions Options;
+	Options.bForceImmediately = false;
+
+	bool bChanged = false;
+
+	// 1) Remove contexts nothing references anymore
+	for (auto It = AppliedContexts.CreateIterator(); It; ++It)
+	{
+		if (!RefCounts.Contains(It.Key()))
+		{
+			if (It.Value())
+			{
+				EnhancedInput->RemoveMappingContext(It.Value(), Options);
+			}
+
+			It.RemoveCurrent();
+			bChanged = true;
+		}
+	}
+
+	// 2) Add newly referenced contexts (ones still streaming are picked up by HandleContextsPreloaded)
+	for (const TPair<FGameplayTag, int32>& RefCount : RefCounts)
+	{
+		if (AppliedContexts.Contains(RefCount.Key))
+		{
+			continue;
+		}
+
+		UInputMappingContext* Context = FindLoadedContext(RefCount.Key);
+		if (!Context)
+		{
+			continue;
+		}
+
+		EnhancedInput->AddMappingContext(Context, UIContextPriority, Options);
+		AppliedContexts.Add(RefCount.Key, Context);
+		bChanged = true;
+	}
+
+	if (bChanged)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[T66UIInputContextSubsystem] Flushed UI input contexts: %d applied"), AppliedContexts.Num());
+	}
+}
+
+UT66UIInputContextSubsystem* UT66UIInputContextSubsystem::GetForPrimaryPlayer(const UGameInstance* GameInstance)
+{
+	const ULocalPlayer* LocalPlayer = GameInstance ? GameInstance->GetFirstGamePlayer() : nullptr;
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UT66UIInputContextSubsystem>() : nullptr;
+}
+
+void UT66UIInputContextSubsystem::HandleRegistryLoaded()
+{
+	LoadedRegistry = InputContextRegistry.Get();
+
+	if (!LoadedRegistry)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIInputContextSubsystem] Failed to load input context registry: %s"), *InputContextRegistry.ToString());
+		return;
+	}
+
+	// Preload every UI IMC up front (they're small, and a modal must never wait on one)
+	TArray<FSoftObjectPath> ContextPaths;
+
+	for (const TPair<FGameplayTag, TSoftObjectPtr<UInputMappingContext>>& Entry : LoadedRegistry->InputContextTagToIMC)
+	{
+		if (!Entry.Value.IsNull())
+		{
+			ContextPaths.AddUnique(Entry.Value.ToSoftObjectPath());
+		}
+	}
+
+	if (ContextPaths.Num() == 0)
+	{
+		return;
+	}
+
+	PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ContextPaths,
+		FStreamableDelegate::CreateUObject(this, &UT66UIInputContextSubsystem::HandleContextsPreloaded),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+}
+
+void UT66UIInputContextSubsystem::HandleContextsPreloaded()
+{
+	UE_LOG(LogTemp, Display, TEXT("[T66UIInputContextSubsystem] Preloaded %d UI input contexts"), LoadedRegistry ? LoadedRegistry->InputContextTagToIMC.Num() : 0);
+
+	// Apply anything pushed while the IMCs were streaming
+	RequestFlush();
+}
+
+void UT66UIInputContextSubsystem::RequestFlush()
+{
+	if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UT66UIInputContextSubsystem::HandleFlushTicker)
+		);
+	}
+}
+
+bool UT66UIInputContextSubsystem::HandleFlushTicker(float DeltaTime)
+{
+	// One-shot: FlushInputContexts resets the handle, returning false removes the ticker
+	FlushTickerHandle.Reset();
+	FlushInputContexts();
+	return false;
+}
+
+UInputMappingContext* UT66UIInputContextSubsystem::FindLoadedContext(const FGameplayTag& InputContextTag) const
+{
+	const TSoftObjectPtr<UInputMappingContext>* SoftContext = LoadedRegistry ? LoadedRegistry->InputContextTagToIMC.Find(InputContextTag) : nullptr;
+	return SoftContext ? SoftContext->Get() : nullptr;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Containers/Ticker.h"
+#include "T66UIInputContextSubsystem.generated.h"
+
+class UGameInstance;
+class UInputMappingContext;
+class UT66UIInputContextRegistryDA;
+struct FStreamableHandle;
+
+/**
+ * UT66UIInputContextSubsystem
+ * - Applies UI.Input.* mapping contexts from DA_T66UIInputContexts (UT66UIInputContextRegistryDA) for one local player
+ * - Ref-counted by tag: two surfaces asking for UI.Input.Modal keep it applied until both are gone
+ * - Every push/pop in a frame is batched into a single flush (one control-mapping rebuild, push+pop in the same frame is a no-op)
+ * - IMC assets are preloaded asynchronously; changes wait for them instead of loading synchronously
+ */
+UCLASS(Config = Game)
+class T66_API UT66UIInputContextSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Adds a reference to a UI.Input.* context (applied on the next flush)
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Input", meta = (GameplayTagFilter = "UI.Input"))
+	void PushInputContext(FGameplayTag InputContextTag);
+
+	// Drops a reference to a UI.Input.* context (removed on the next flush once nothing references it)
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Input", meta = (GameplayTagFilter = "UI.Input"))
+	void PopInputContext(FGameplayTag InputContextTag);
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Input", meta = (GameplayTagFilter = "UI.Input"))
+	int32 GetInputContextRefCount(FGameplayTag InputContextTag) const { return RefCounts.FindRef(InputContextTag); }
+
+	// Applies pending changes right away (normally done once at the end of the frame)
+	void FlushInputContexts();
+
+	// Convenience for GameInstance-level UI systems (the router)
+	static UT66UIInputContextSubsystem* GetForPrimaryPlayer(const UGameInstance* GameInstance);
+
+protected:
+	// Registry asset, set in DefaultGame.ini (always cooked as a primary asset).
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Input")
+	TSoftObjectPtr<UT66UIInputContextRegistryDA> InputContextRegistry;
+
+	// Priority UI contexts are added with (above gameplay contexts, which use 0)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Input")
+	int32 UIContextPriority = 100;
+
+private:
+	void HandleRegistryLoaded();
+	void HandleContextsPreloaded();
+
+	// Schedules one flush at the end of this frame
+	void RequestFlush();
+	bool HandleFlushTicker(float DeltaTime);
+
+	UInputMappingContext* FindLoadedContext(const FGameplayTag& InputContextTag) const;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UT66UIInputContextRegistryDA> LoadedRegistry = nullptr;
+
+	// Wanted references per tag
+	TMap<FGameplayTag, int32> RefCounts;
+
+	// Contexts currently added to Enhanced Input (tag -> the IMC we added, so a removal matches even after a registry change)
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, TObjectPtr<UInputMappingContext>> AppliedContexts;
+
+	TSharedPtr<FStreamableHandle> RegistryHandle;
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+};
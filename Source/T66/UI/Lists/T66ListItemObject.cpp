@@ -0,0 +1 @@
+#include "UI/Lists/T66ListItemObject.h"
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "T66ListItemObject.generated.h"
+
+class UTexture2D;
+
+/**
+ * One row of a list screen (save slot, achievement, run event...).
+ * Filled by a UT66ListProvider; plain data so gathering 500 rows never touches a widget.
+ */
+USTRUCT(BlueprintType)
+struct T66_API FT66ListItemData
+{
+	GENERATED_BODY()
+
+	/** Stable ID of what the row shows (slot name, achievement ID, split name...). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|List")
+	FName ItemID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|List")
+	FText Title;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|List")
+	FText Subtitle;
+
+	/** Right-aligned value (ex: a time, a date, 3/10). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|List")
+	FText Value;
+
+	/** Soft so gathering rows never loads icons; entries stream them when they're bound. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|List")
+	TSoftObjectPtr<UTexture2D> Icon;
+
+	/** 0..1 progress (ex: achievement progress). Negative = no progress bar. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|List")
+	float Progress = -1.f;
+
+	/** Greyed out / not selectable (ex: locked achievement, empty slot). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|List")
+	bool bLocked = false;
+};
+
+/**
+ * List view item for UT66ListScreenWidgetBase.
+ * Pooled by the screen: a refresh rewrites Data in place instead of allocating new items.
+ */
+UCLASS(BlueprintType)
+class T66_API UT66ListItemObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List")
+	FT66ListItemData Data;
+
+	/** Row index in the list. */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List")
+	int32 Index = INDEX_NONE;
+};
@@ -0,0 +1,86 @@
+#include "UI/Lists/T66ListProvider.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Engine/World.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "T66RunTimerSubsystem.h"
+
+const FName UT66SaveSlotsListProvider::EmptySlotID(TEXT("EmptySlot"));
+
+void UT66SaveSlotsListProvider::GatherItems_Implementation(const UUserWidget* OwningWidget, TArray<FT66ListItemData>& OutItems) const
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+
+	TArray<FString> SaveNames;
+	if (SaveSystem)
+	{
+		SaveSystem->GetSaveGameNames(SaveNames, UserIndex);
+	}
+
+	SaveNames.Sort();
+
+	for (const FString& SaveName : SaveNames)
+	{
+		if (!SaveName.StartsWith(SlotPrefix))
+		{
+			continue;
+		}
+
+		FT66ListItemData& Item = OutItems.AddDefaulted_GetRef();
+		Item.ItemID = FName(*SaveName);
+		Item.Title = FText::FromString(SaveName.RightChop(SlotPrefix.Len()));
+	}
+
+	if (bAddEmptySlot)
+	{
+		FT66ListItemData& Item = OutItems.AddDefaulted_GetRef();
+		Item.ItemID = EmptySlotID;
+		Item.Title = NSLOCTEXT("T66Lists", "EmptySlot", "Empty Slot");
+	}
+}
+
+bool UT66SaveSlotsListProvider::DeleteItem_Implementation(const UUserWidget* OwningWidget, const FT66ListItemData& Item) const
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+
+	if (!SaveSystem || Item.ItemID.IsNone() || Item.ItemID == EmptySlotID)
+	{
+		return false;
+	}
+
+	return SaveSystem->DeleteGame(/*bAttemptToUseUI=*/false, *Item.ItemID.ToString(), UserIndex);
+}
+
+void UT66RunSplitsListProvider::GatherItems_Implementation(const UUserWidget* OwningWidget, TArray<FT66ListItemData>& OutItems) const
+{
+	const UWorld* World = OwningWidget ? OwningWidget->GetWorld() : nullptr;
+	const UT66RunTimerSubsystem* Timer = World ? World->GetSubsystem<UT66RunTimerSubsystem>() : nullptr;
+
+	if (!Timer)
+	{
+		return;
+	}
+
+	const int32 PrecisionMs = UT66RunTimerSubsystem::GetDisplayPrecisionMs();
+	const FT66RunRecord& Record = Timer->GetRecord();
+
+	OutItems.Reserve(OutItems.Num() + Timer->GetSplits().Num());
+
+	for (const FT66RunSplit& Split : Timer->GetSplits())
+	{
+		FT66ListItemData& Item = OutItems.AddDefaulted_GetRef();
+		Item.ItemID = Split.Name;
+		Item.Title = FText::FromName(Split.Name);
+		Item.Value = UT66RunTimerSubsystem::FormatTime(Split.RunTimeUs, PrecisionMs);
+
+		const int64 BestRunTimeUs = Record.FindBestRunTime(Split.Name);
+		if (BestRunTimeUs >= 0)
+		{
+			const int64 DeltaUs = Split.RunTimeUs - BestRunTimeUs;
+			const FText DeltaText = UT66RunTimerSubsystem::FormatTime(DeltaUs, PrecisionMs);
+
+			Item.Subtitle = DeltaUs > 0 ? FText::Format(NSLOCTEXT("T66Lists", "BehindFormat", "+{0}"), DeltaText) : DeltaText;
+		}
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "UI/Lists/T66ListItemObject.h"
+#include "T66ListProvider.generated.h"
+
+class UUserWidget;
+
+/**
+ * Feeds rows to a UT66ListScreenWidgetBase.
+ * Set one (instanced) in the screen's class defaults. Native providers below; blueprint
+ * subclasses can override GatherItems for data that has no native source yet (ex: achievements).
+ */
+UCLASS(Abstract, Blueprintable, EditInlineNew, DefaultToInstanced)
+class T66_API UT66ListProvider : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Appends every row (plain data only — the list view only builds widgets for visible rows). */
+	UFUNCTION(BlueprintNativeEvent, Category = "T66|UI|List")
+	void GatherItems(const UUserWidget* OwningWidget, TArray<FT66ListItemData>& OutItems) const;
+	virtual void GatherItems_Implementation(const UUserWidget* OwningWidget, TArray<FT66ListItemData>& OutItems) const {}
+
+	/** Deletes what a row shows (ex: its save file). Returns false if the row can't be deleted. */
+	UFUNCTION(BlueprintNativeEvent, Category = "T66|UI|List")
+	bool DeleteItem(const UUserWidget* OwningWidget, const FT66ListItemData& Item) const;
+	virtual bool DeleteItem_Implementation(const UUserWidget* OwningWidget, const FT66ListItemData& Item) const { return false; }
+};
+
+/**
+ * Save slots (WBP_Screen_SaveSlots): every save game whose name starts with SlotPrefix.
+ * One directory listing through the platform save system, no save is loaded.
+ */
+UCLASS(meta = (DisplayName = "Save Slots"))
+class T66_API UT66SaveSlotsListProvider : public UT66ListProvider
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherItems_Implementation(const UUserWidget* OwningWidget, TArray<FT66ListItemData>& OutItems) const override;
+
+	/** Deletes the slot's save game (the empty slot row can't be deleted). */
+	virtual bool DeleteItem_Implementation(const UUserWidget* OwningWidget, const FT66ListItemData& Item) const override;
+
+	/** ItemID of the "Empty Slot" row. Save names always start with SlotPrefix, so it can't collide with a slot. */
+	static const FName EmptySlotID;
+
+protected:
+	UPROPERTY(EditAnywhere, Category = "T66|UI|List")
+	FString SlotPrefix = TEXT("Slot_");
+
+	UPROPERTY(EditAnywhere, Category = "T66|UI|List")
+	int32 UserIndex = 0;
+
+	/** Adds an "Empty Slot" row (ItemID EmptySlotID) at the end so a new game can be started from the list. */
+	UPROPERTY(EditAnywhere, Category = "T66|UI|List")
+	bool bAddEmptySlot = true;
+};
+
+/**
+ * Run timeline (WBP_Screen_RunDetails): splits of the current/last run in the world's run timer,
+ * with the difference to the personal best.
+ */
+UCLASS(meta = (DisplayName = "Run Splits"))
+class T66_API UT66RunSplitsListProvider : public UT66ListProvider
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherItems_Implementation(const UUserWidget* OwningWidget, TArray<FT66ListItemData>& OutItems) const override;
+};
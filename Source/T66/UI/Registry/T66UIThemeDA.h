@@ -18,6 +18,16 @@ struct FT66UIThemeTextStyle
 	float LetterSpacing = 0.0f;
 };
 
+USTRUCT(BlueprintType)
+struct FT66UISoundGroup
+{
+	GENERATED_BODY()
+
+	// Sound tokens streamed in (and released) together
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI Theme")
+	TArray<FName> Tokens;
+};
+
 UCLASS(BlueprintType)
 class T66_API UT66UIThemeDA : public UPrimaryDataAsset
 {
@@ -39,6 +49,15 @@ public:
 	// (lets us auto-fill DA_UITheme_* assets)
 	// ----------------------------
 
+	// Optional prefix for every token (and sound group entry) of this asset (ex: "Button" compiles "Text.Color" as "Button.Text.Color").
+	// Tokens already starting with the prefix are left alone. Keeps split assets from overriding each other's tokens.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI Theme|Tokens")
+	FName TokenNamespace;
+
+	// Set on variant assets (ex: colorblind, seasonal) meant to override earlier assets, so their overrides don't warn
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI Theme|Tokens")
+	bool bOverridesEarlierTokens = false;
+
 	// Colors by token name (ex: "Text.Primary", "Panel.Bg", "Accent.1")
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI Theme|Tokens")
 	TMap<FName, FLinearColor> ColorTokens;
@@ -56,6 +75,11 @@ public:
 	TMap<FName, FVector2D> Vector2Tokens;
 
 	// Audio references by token name (ex: "SFX.UI.Hover", "SFX.UI.Click")
+	// Soft, so loading a theme asset never pulls audio in. UT66UISoundSubsystem streams them by SoundGroups.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI Theme|Tokens")
+	TMap<FName, TSoftObjectPtr<USoundBase>> SoundTokens;
+
+	// Sound tokens that stream in together (ex: "Frontend" -> menu hover/click, "InRun" -> HUD/pickup sounds)
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI Theme|Tokens")
-	TMap<FName, TObjectPtr<USoundBase>> SoundTokens;
+	TMap<FName, FT66UISoundGroup> SoundGroups;
 };
@@ -0,0 +1,633 @@
+#include "UI/Router/T66UIRouterSubsystem.h"
+
+#include "UI/Input/T66UIInputContextSubsystem.h"
+#include "UI/Registry/T66UISurfaceRegistryDataAsset.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace T66UIRouter
+{
+	static FGameplayTag ScreenTag() { return FGameplayTag::RequestGameplayTag(FName(TEXT("UI.Screen")), /*ErrorIfNotFound=*/false); }
+	static FGameplayTag ModalTag() { return FGameplayTag::RequestGameplayTag(FName(TEXT("UI.Modal")), /*ErrorIfNotFound=*/false); }
+	static FGameplayTag OverlayTag() { return FGameplayTag::RequestGameplayTag(FName(TEXT("UI.Overlay")), /*ErrorIfNotFound=*/false); }
+	static FGameplayTag TooltipTag() { return FGameplayTag::RequestGameplayTag(FName(TEXT("UI.Tooltip")), /*ErrorIfNotFound=*/false); }
+	static FGameplayTag LoadingBlockerTag() { return FGameplayTag::RequestGameplayTag(FName(TEXT("UI.Overlay.LoadingBlocker")), /*ErrorIfNotFound=*/false); }
+}
+
+void UT66UIRouterSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
+		this,
+		&UT66UIRouterSubsystem::HandlePostLoadMapWithWorld
+	);
+
+	if (SurfaceRegistry.IsNull())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIRouterSubsystem] No UT66UISurfaceRegistryDataAsset configured (SurfaceRegistry in DefaultGame.ini). Surfaces can't be routed."));
+	}
+	else
+	{
+		RegistryHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			SurfaceRegistry.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UT66UIRouterSubsystem::HandleRegistryLoaded),
+			FStreamableManager::AsyncLoadHighPriority
+		);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIRouterSubsystem] Initialized"));
+}
+
+void UT66UIRouterSubsystem::Deinitialize()
+{
+	if (PostLoadMapHandle.IsValid())
+	{
+		FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+		PostLoadMapHandle.Reset();
+	}
+
+	for (TPair<FGameplayTag, TSharedPtr<FStreamableHandle>>& Pending : PendingLoads)
+	{
+		if (Pending.Value.IsValid())
+		{
+			Pending.Value->CancelHandle();
+		}
+	}
+
+	PendingLoads.Reset();
+
+	if (RegistryHandle.IsValid())
+	{
+		RegistryHandle->CancelHandle();
+		RegistryHandle.Reset();
+	}
+
+	if (LoadingBlockerHandle.IsValid())
+	{
+		LoadingBlockerHandle->CancelHandle();
+		LoadingBlockerHandle.Reset();
+	}
+
+	// Take everything off screen
+	auto RemoveWidget = [](UUserWidget* Widget)
+		{
+			if (Widget)
+			{
+				Widget->RemoveFromParent();
+			}
+		};
+
+	for (const FT66UIRouterEntry& Entry : Stack)
+	{
+		RemoveWidget(Entry.Widget);
+	}
+
+	for (const FT66UIRouterEntry& Entry : Overlays)
+	{
+		RemoveWidget(Entry.Widget);
+	}
+
+	RemoveWidget(LoadingBlocker);
+
+	Stack.Reset();
+	Overlays.Reset();
+	Cache.Reset();
+	LoadingBlocker = nullptr;
+	LoadedRegistry = nullptr;
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIRouterSubsystem] Deinitialized"));
+
+	Super::Deinitialize();
+}
+
+bool UT66UIRouterSubsystem::PushSurface(FGameplayTag SurfaceTag)
+{
+	const ET66UISurfaceType SurfaceType = GetSurfaceTypeForTag(SurfaceTag);
+
+	if (SurfaceType == ET66UISurfaceType::Unknown)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIRouterSubsystem] %s is not a routable surface tag"), *SurfaceTag.ToString());
+		return false;
+	}
+
+	// Tooltips are pooled by UT66UITooltipSubsystem (a routed tooltip would be created per hover)
+	if (SurfaceType == ET66UISurfaceType::Tooltip)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIRouterSubsystem] %s is a tooltip, use UT66UITooltipSubsystem::RequestTooltip"), *SurfaceTag.ToString());
+		return false;
+	}
+
+	if (IsSurfaceOpen(SurfaceTag))
+	{
+		return false;
+	}
+
+	FT66UIRouterEntry Entry;
+	Entry.SurfaceTag = SurfaceTag;
+	Entry.SurfaceType = SurfaceType;
+
+	if (SurfaceType == ET66UISurfaceType::Overlay)
+	{
+		Overlays.Add(Entry);
+	}
+	else
+	{
+		Stack.Add(Entry);
+	}
+
+	// Reserve the slot now (so stack order follows push order), fill the widget in once the class is ready
+	RequestSurfaceWidget(SurfaceTag);
+	UpdateLoadingBlocker();
+
+	// No widget class registered: the entry was dropped again
+	return IsSurfaceOpen(SurfaceTag);
+}
+
+void UT66UIRouterSubsystem::PopSurface()
+{
+	if (Stack.Num() > 0)
+	{
+		RemoveSurface(Stack.Last().SurfaceTag);
+	}
+}
+
+void UT66UIRouterSubsystem::RemoveSurface(FGameplayTag SurfaceTag)
+{
+	const int32 StackIndex = Stack.IndexOfByPredicate([&SurfaceTag](const FT66UIRouterEntry& Entry) { return Entry.SurfaceTag == SurfaceTag; });
+
+	if (StackIndex != INDEX_NONE)
+	{
+		// Detach first so close listeners can safely push new surfaces
+		TArray<FT66UIRouterEntry> Closed(Stack.GetData() + StackIndex, Stack.Num() - StackIndex);
+		Stack.SetNum(StackIndex);
+
+		// Close from the top down so everything above goes too
+		for (int32 Index = Closed.Num() - 1; Index >= 0; --Index)
+		{
+			CloseEntry(Closed[Index]);
+		}
+
+		RefreshStack();
+
+		// Focus goes back to the surface that's on top again
+		if (Stack.Num() > 0)
+		{
+			if (UT66WidgetBase* TopWidget = Cast<UT66WidgetBase>(Stack.Last().Widget))
+			{
+				TopWidget->FocusDefaultControl();
+			}
+		}
+	}
+	else
+	{
+		const int32 OverlayIndex = Overlays.IndexOfByPredicate([&SurfaceTag](const FT66UIRouterEntry& Entry) { return Entry.SurfaceTag == SurfaceTag; });
+
+		if (OverlayIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		FT66UIRouterEntry Closed = Overlays[OverlayIndex];
+		Overlays.RemoveAt(OverlayIndex);
+		CloseEntry(Closed);
+	}
+
+	UpdateLoadingBlocker();
+}
+
+bool UT66UIRouterSubsystem::IsSurfaceOpen(FGameplayTag SurfaceTag) const
+{
+	auto Matches = [&SurfaceTag](const FT66UIRouterEntry& Entry) { return Entry.SurfaceTag == SurfaceTag; };
+	return Stack.ContainsByPredicate(Matches) || Overlays.ContainsByPredicate(Matches);
+}
+
+FGameplayTag UT66UIRouterSubsystem::GetTopSurface() const
+{
+	return Stack.Num() > 0 ? Stack.Last().SurfaceTag : FGameplayTag();
+}
+
+UUserWidget* UT66UIRouterSubsystem::GetSurfaceWidget(FGameplayTag SurfaceTag) const
+{
+	auto Matches = [&SurfaceTag](const FT66UIRouterEntry& Entry) { return Entry.SurfaceTag == SurfaceTag; };
+
+	const FT66UIRouterEntry* Entry = Stack.FindByPredicate(Matches);
+	if (!Entry)
+	{
+		Entry = Overlays.FindByPredicate(Matches);
+	}
+
+	return Entry ? Entry->Widget.Get() : nullptr;
+}
+
+void UT66UIRouterSubsystem::FlushCache()
+{
+	Cache.Reset();
+}
+
+ET66UISurfaceType UT66UIRouterSubsystem::GetSurfaceTypeForTag(const FGameplayTag& SurfaceTag)
+{
+	if (!SurfaceTag.IsValid())
+	{
+		return ET66UISurfaceType::Unknown;
+	}
+
+	if (SurfaceTag.MatchesTag(T66UIRouter::ScreenTag()))
+	{
+		return ET66UISurfaceType::Screen;
+	}
+
+	if (SurfaceTag.MatchesTag(T66UIRouter::ModalTag()))
+	{
+		return ET66UISurfaceType::Modal;
+	}
+
+	if (SurfaceTag.MatchesTag(T66UIRouter::OverlayTag()))
+	{
+		return ET66UISurfaceType::Overlay;
+	}
+
+	if (SurfaceTag.MatchesTag(T66UIRouter::TooltipTag()))
+	{
+		return ET66UISurfaceType::Tooltip;
+	}
+
+	return ET66UISurfaceType::Unknown;
+}
+
+void UT66UIRouterSubsystem::HandleRegistryLoaded()
+{
+	LoadedRegistry = SurfaceRegistry.Get();
+
+	if (!LoadedRegistry)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIRouterSubsystem] Failed to load surface registry: %s"), *SurfaceRegistry.ToString());
+		return;
+	}
+
+	// ✅ Preload the loading blocker so it's ready before the first real async load
+	const TSoftClassPtr<UUserWidget> BlockerClass = FindSurfaceClass(T66UIRouter::LoadingBlockerTag());
+	if (!BlockerClass.IsNull())
+	{
+		LoadingBlockerHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			BlockerClass.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UT66UIRouterSubsystem::UpdateLoadingBlocker),
+			FStreamableManager::AsyncLoadHighPriority
+		);
+	}
+
+	// Resolve anything pushed before the registry was ready
+	TArray<FGameplayTag> WaitingTags;
+
+	for (const FT66UIRouterEntry& Entry : Stack)
+	{
+		WaitingTags.Add(Entry.SurfaceTag);
+	}
+
+	for (const FT66UIRouterEntry& Entry : Overlays)
+	{
+		WaitingTags.Add(Entry.SurfaceTag);
+	}
+
+	for (const FGameplayTag& SurfaceTag : WaitingTags)
+	{
+		RequestSurfaceWidget(SurfaceTag);
+	}
+
+	UpdateLoadingBlocker();
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIRouterSubsystem] Surface registry ready: %d surfaces"), LoadedRegistry->SurfaceTagToWidgetClass.Num());
+}
+
+void UT66UIRouterSubsystem::HandlePostLoadMapWithWorld(UWorld* LoadedWorld)
+{
+	// Multi-client PIE: every instance gets this broadcast, only react to our own
+	if (!LoadedWorld || LoadedWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	AttachOpenWidgets();
+}
+
+void UT66UIRouterSubsystem::RequestSurfaceWidget(FGameplayTag SurfaceTag)
+{
+	// Registry still streaming: HandleRegistryLoaded will come back here
+	if (!LoadedRegistry)
+	{
+		return;
+	}
+
+	FT66UIRouterEntry* Entry = FindOpenEntry(SurfaceTag);
+	if (!Entry || Entry->Widget || PendingLoads.Contains(SurfaceTag))
+	{
+		return;
+	}
+
+	const TSoftClassPtr<UUserWidget> SoftClass = FindSurfaceClass(SurfaceTag);
+
+	// Cached instances and already loaded classes open this frame, no blocker
+	if (SoftClass.Get() || Cache.ContainsByPredicate([&SurfaceTag](const FT66UIRouterEntry& Cached) { return Cached.SurfaceTag == SurfaceTag; }))
+	{
+		ShowEntryWidget(*Entry);
+		return;
+	}
+
+	if (SoftClass.IsNull())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIRouterSubsystem] No widget class registered for %s"), *SurfaceTag.ToString());
+		DiscardEntry(SurfaceTag);
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		SoftClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UT66UIRouterSubsystem::HandleSurfaceClassLoaded, SurfaceTag),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+
+	// The delegate may already have fired if everything was resident
+	if (Handle.IsValid() && !Handle->HasLoadCompleted())
+	{
+		PendingLoads.Add(SurfaceTag, Handle);
+	}
+}
+
+void UT66UIRouterSubsystem::HandleSurfaceClassLoaded(FGameplayTag SurfaceTag)
+{
+	PendingLoads.Remove(SurfaceTag);
+
+	// Closed while it was streaming
+	FT66UIRouterEntry* Entry = FindOpenEntry(SurfaceTag);
+	if (!Entry || Entry->Widget)
+	{
+		return;
+	}
+
+	if (!FindSurfaceClass(SurfaceTag).Get())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIRouterSubsystem] Failed to load widget class for %s"), *SurfaceTag.ToString());
+		DiscardEntry(SurfaceTag);
+		return;
+	}
+
+	ShowEntryWidget(*Entry);
+	UpdateLoadingBlocker();
+}
+
+void UT66UIRouterSubsystem::ShowEntryWidget(FT66UIRouterEntry& Entry)
+{
+	UUserWidget* Widget = TakeCachedWidget(Entry.SurfaceTag);
+
+	if (!Widget)
+	{
+		UClass* WidgetClass = FindSurfaceClass(Entry.SurfaceTag).Get();
+		if (!WidgetClass)
+		{
+			return;
+		}
+
+		// Owned by the GameInstance so the instance outlives map travel (and the cache can keep it)
+		Widget = CreateWidget<UUserWidget>(GetGameInstance(), WidgetClass);
+		if (!Widget)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[T66UIRouterSubsystem] Failed to create widget for %s"), *Entry.SurfaceTag.ToString());
+			return;
+		}
+	}
+
+	Entry.Widget = Widget;
+
+	if (Entry.SurfaceType == ET66UISurfaceType::Overlay)
+	{
+		Widget->AddToViewport(GetZOrderForEntry(Entry));
+	}
+	else
+	{
+		RefreshStack();
+	}
+
+	// Surface-specific input (ref-counted, batched into one mapping rebuild per frame)
+	UT66WidgetBase* SurfaceWidget = Cast<UT66WidgetBase>(Widget);
+	if (SurfaceWidget && SurfaceWidget->InputContextTag.IsValid())
+	{
+		if (UT66UIInputContextSubsystem* InputContexts = UT66UIInputContextSubsystem::GetForPrimaryPlayer(GetGameInstance()))
+		{
+			InputContexts->PushInputContext(SurfaceWidget->InputContextTag);
+		}
+	}
+
+	// Controller users land on the surface's DefaultFocusID (overlays never take focus, nor does a surface
+	// that finished streaming under a newer one)
+	if (SurfaceWidget && Entry.SurfaceType != ET66UISurfaceType::Overlay && GetTopSurface() == Entry.SurfaceTag)
+	{
+		SurfaceWidget->FocusDefaultControl();
+	}
+
+	OnSurfaceChanged.Broadcast(Entry.SurfaceTag, true);
+}
+
+void UT66UIRouterSubsystem::CloseEntry(FT66UIRouterEntry& Entry)
+{
+	// Still streaming: drop the request
+	if (TSharedPtr<FStreamableHandle> Pending = PendingLoads.FindRef(Entry.SurfaceTag))
+	{
+		Pending->CancelHandle();
+		PendingLoads.Remove(Entry.SurfaceTag);
+	}
+
+	if (!Entry.Widget)
+	{
+		return;
+	}
+
+	Entry.Widget->RemoveFromParent();
+
+	const UT66WidgetBase* SurfaceWidget = Cast<UT66WidgetBase>(Entry.Widget);
+	if (SurfaceWidget && SurfaceWidget->InputContextTag.IsValid())
+	{
+		if (UT66UIInputContextSubsystem* InputContexts = UT66UIInputContextSubsystem::GetForPrimaryPlayer(GetGameInstance()))
+		{
+			InputContexts->PopInputContext(SurfaceWidget->InputContextTag);
+		}
+	}
+
+	// Keep it for instant reopen (most recently used goes last)
+	if (CacheCapacity.FindRef(Entry.SurfaceType) > 0)
+	{
+		Cache.Add(Entry);
+		TrimCache(Entry.SurfaceType);
+	}
+
+	Entry.Widget = nullptr;
+
+	OnSurfaceChanged.Broadcast(Entry.SurfaceTag, false);
+}
+
+void UT66UIRouterSubsystem::DiscardEntry(const FGameplayTag& SurfaceTag)
+{
+	// Never shown, so nothing to close: surfaces pushed above it stay open
+	auto Matches = [&SurfaceTag](const FT66UIRouterEntry& Entry) { return Entry.SurfaceTag == SurfaceTag; };
+	Stack.RemoveAll(Matches);
+	Overlays.RemoveAll(Matches);
+
+	RefreshStack();
+	UpdateLoadingBlocker();
+}
+
+void UT66UIRouterSubsystem::RefreshStack()
+{
+	// Everything below the top-most Screen is hidden by it
+	int32 FirstVisibleIndex = 0;
+
+	for (int32 Index = Stack.Num() - 1; Index >= 0; --Index)
+	{
+		if (Stack[Index].SurfaceType == ET66UISurfaceType::Screen)
+		{
+			FirstVisibleIndex = Index;
+			break;
+		}
+	}
+
+	for (int32 Index = 0; Index < Stack.Num(); ++Index)
+	{
+		UUserWidget* Widget = Stack[Index].Widget;
+		if (!Widget)
+		{
+			continue;
+		}
+
+		// Hidden entries leave the viewport entirely so they cost nothing to paint or hit test
+		if (Index < FirstVisibleIndex)
+		{
+			if (Widget->IsInViewport())
+			{
+				Widget->RemoveFromParent();
+			}
+		}
+		else if (!Widget->IsInViewport())
+		{
+			Widget->AddToViewport(GetZOrderForEntry(Stack[Index]));
+		}
+	}
+}
+
+void UT66UIRouterSubsystem::AttachOpenWidgets()
+{
+	RefreshStack();
+
+	for (const FT66UIRouterEntry& Entry : Overlays)
+	{
+		if (Entry.Widget && !Entry.Widget->IsInViewport())
+		{
+			Entry.Widget->AddToViewport(GetZOrderForEntry(Entry));
+		}
+	}
+
+	UpdateLoadingBlocker();
+}
+
+void UT66UIRouterSubsystem::UpdateLoadingBlocker()
+{
+	auto IsStreaming = [](const FT66UIRouterEntry& Entry) { return Entry.Widget == nullptr; };
+	const bool bLoading = Stack.ContainsByPredicate(IsStreaming) || Overlays.ContainsByPredicate(IsStreaming);
+
+	if (!bLoading)
+	{
+		if (LoadingBlocker && LoadingBlocker->IsInViewport())
+		{
+			LoadingBlocker->RemoveFromParent();
+		}
+
+		return;
+	}
+
+	if (!LoadingBlocker)
+	{
+		// Not preloaded yet: nothing to show, the preload callback comes back here
+		UClass* BlockerClass = FindSurfaceClass(T66UIRouter::LoadingBlockerTag()).Get();
+		if (!BlockerClass)
+		{
+			return;
+		}
+
+		LoadingBlocker = CreateWidget<UUserWidget>(GetGameInstance(), BlockerClass);
+	}
+
+	if (LoadingBlocker && !LoadingBlocker->IsInViewport())
+	{
+		LoadingBlocker->AddToViewport(LoadingBlockerZOrder);
+	}
+}
+
+FT66UIRouterEntry* UT66UIRouterSubsystem::FindOpenEntry(const FGameplayTag& SurfaceTag)
+{
+	auto Matches = [&SurfaceTag](const FT66UIRouterEntry& Entry) { return Entry.SurfaceTag == SurfaceTag; };
+
+	if (FT66UIRouterEntry* Entry = Stack.FindByPredicate(Matches))
+	{
+		return Entry;
+	}
+
+	return Overlays.FindByPredicate(Matches);
+}
+
+int32 UT66UIRouterSubsystem::GetZOrderForEntry(const FT66UIRouterEntry& Entry) const
+{
+	if (Entry.SurfaceType == ET66UISurfaceType::Overlay)
+	{
+		const int32 OverlayIndex = Overlays.IndexOfByPredicate([&Entry](const FT66UIRouterEntry& Other) { return Other.SurfaceTag == Entry.SurfaceTag; });
+		return OverlayZOrder + FMath::Max(0, OverlayIndex);
+	}
+
+	const int32 StackIndex = Stack.IndexOfByPredicate([&Entry](const FT66UIRouterEntry& Other) { return Other.SurfaceTag == Entry.SurfaceTag; });
+	return StackZOrder + FMath::Max(0, StackIndex);
+}
+
+UUserWidget* UT66UIRouterSubsystem::TakeCachedWidget(const FGameplayTag& SurfaceTag)
+{
+	const int32 CacheIndex = Cache.IndexOfByPredicate([&SurfaceTag](const FT66UIRouterEntry& Cached) { return Cached.SurfaceTag == SurfaceTag; });
+
+	if (CacheIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	UUserWidget* Widget = Cache[CacheIndex].Widget;
+	Cache.RemoveAt(CacheIndex);
+	return Widget;
+}
+
+void UT66UIRouterSubsystem::TrimCache(ET66UISurfaceType SurfaceType)
+{
+	const int32 Capacity = FMath::Max(0, CacheCapacity.FindRef(SurfaceType));
+
+	int32 NumOfType = 0;
+	for (const FT66UIRouterEntry& Cached : Cache)
+	{
+		NumOfType += Cached.SurfaceType == SurfaceType ? 1 : 0;
+	}
+
+	// Evict least recently used first (front of the array)
+	for (int32 Index = 0; Index < Cache.Num() && NumOfType > Capacity; )
+	{
+		if (Cache[Index].SurfaceType == SurfaceType)
+		{
+			Cache.RemoveAt(Index);
+			--NumOfType;
+		}
+		else
+		{
+			++Index;
+		}
+	}
+}
+
+TSoftClassPtr<UUserWidget> UT66UIRouterSubsystem::FindSurfaceClass(const FGameplayTag& SurfaceTag) const
+{
+	return LoadedRegistry ? LoadedRegistry->SurfaceTagToWidgetClass.FindRef(SurfaceTag) : TSoftClassPtr<UUserWidget>();
+}
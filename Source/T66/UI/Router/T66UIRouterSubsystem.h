@@ -0,0 +1,167 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "T66UIRouterSubsystem.generated.h"
+
+class UUserWidget;
+class UT66UISurfaceRegistryDataAsset;
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FT66OnUISurfaceChanged, FGameplayTag, SurfaceTag, bool, bOpen);
+
+/** One routed surface: its tag and (once loaded) its widget instance */
+USTRUCT()
+struct FT66UIRouterEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag SurfaceTag;
+
+	UPROPERTY()
+	ET66UISurfaceType SurfaceType = ET66UISurfaceType::Unknown;
+
+	// Null while the class is still streaming
+	UPROPERTY()
+	TObjectPtr<UUserWidget> Widget = nullptr;
+};
+
+/**
+ * UT66UIRouterSubsystem
+ * - Opens UI surfaces by GameplayTag through DA_UIRegistry_Surfaces (UI.Screen.*, UI.Modal.*, UI.Overlay.*)
+ * - UI.Tooltip.* are not routed: UT66UITooltipSubsystem pools them
+ * - Screens + Modals live on one stack: a Screen hides everything below it, a Modal keeps the Screen under it visible
+ * - The top of the stack focuses its DefaultFocusID when it opens or is uncovered again
+ * - Overlays live in their own layer above the stack, independent of each other
+ * - Widget classes stream in asynchronously; UI.Overlay.LoadingBlocker is shown while anything is loading
+ * - Closed widgets are kept in an LRU cache (capacity per surface type, see CacheCapacity) for instant reopen
+ * - Widgets are owned by the GameInstance and re-added to the viewport after map travel
+ */
+UCLASS(Config = Game)
+class T66_API UT66UIRouterSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Opens a surface. Screens/Modals are pushed on the stack, Overlays are added to the overlay layer.
+	// Returns false if the tag isn't a routable surface, is already open, or has no widget class registered.
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Router", meta = (GameplayTagFilter = "UI"))
+	bool PushSurface(FGameplayTag SurfaceTag);
+
+	// Closes the top of the Screen/Modal stack
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Router")
+	void PopSurface();
+
+	// Closes a surface wherever it is (stack or overlay layer). Anything stacked above it is closed too.
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Router", meta = (GameplayTagFilter = "UI"))
+	void RemoveSurface(FGameplayTag SurfaceTag);
+
+	// True if the surface is open (or streaming in)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Router", meta = (GameplayTagFilter = "UI"))
+	bool IsSurfaceOpen(FGameplayTag SurfaceTag) const;
+
+	// Tag of the top of the Screen/Modal stack (empty if the stack is empty)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Router")
+	FGameplayTag GetTopSurface() const;
+
+	// Widget for an open surface (null if closed or still streaming)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Router", meta = (GameplayTagFilter = "UI"))
+	UUserWidget* GetSurfaceWidget(FGameplayTag SurfaceTag) const;
+
+	// Drops every cached (closed) widget
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Router")
+	void FlushCache();
+
+	// Broadcast whenever a surface opens (after its widget is in the viewport) or closes
+	UPROPERTY(BlueprintAssignable, Category = "T66|UI|Router")
+	FT66OnUISurfaceChanged OnSurfaceChanged;
+
+	// Maps a surface tag to its surface type from its UI.Screen/Modal/Overlay/Tooltip parent
+	static ET66UISurfaceType GetSurfaceTypeForTag(const FGameplayTag& SurfaceTag);
+
+protected:
+	// Surface registry, set in DefaultGame.ini (always cooked as a primary asset).
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Router")
+	TSoftObjectPtr<UT66UISurfaceRegistryDataAsset> SurfaceRegistry;
+
+	// Max closed widgets kept alive per surface type (0 = never cache that type)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Router")
+	TMap<ET66UISurfaceType, int32> CacheCapacity =
+	{
+		{ ET66UISurfaceType::Screen, 3 },
+		{ ET66UISurfaceType::Modal, 2 },
+		{ ET66UISurfaceType::Overlay, 4 }
+	};
+
+private:
+	// Viewport ZOrders per layer (stack entries add their index)
+	static constexpr int32 StackZOrder = 10;
+	static constexpr int32 OverlayZOrder = 50;
+	static constexpr int32 LoadingBlockerZOrder = 100;
+
+	void HandleRegistryLoaded();
+	void HandlePostLoadMapWithWorld(UWorld* LoadedWorld);
+
+	// Starts streaming the class for an open entry (or creates the widget right away if it's loaded)
+	void RequestSurfaceWidget(FGameplayTag SurfaceTag);
+	void HandleSurfaceClassLoaded(FGameplayTag SurfaceTag);
+
+	// Creates (or pulls from the cache) the widget for an open entry and puts it on screen
+	void ShowEntryWidget(FT66UIRouterEntry& Entry);
+
+	// Cancels its load or takes the widget off screen and moves it to the cache
+	void CloseEntry(FT66UIRouterEntry& Entry);
+
+	// Drops an entry whose widget class is missing or failed to load, leaving the rest of the stack alone
+	void DiscardEntry(const FGameplayTag& SurfaceTag);
+
+	// Takes stack entries hidden by a Screen above them off the viewport, (re)adds the rest
+	void RefreshStack();
+
+	// Re-adds every open widget after travel cleared the viewport
+	void AttachOpenWidgets();
+
+	// Shows UI.Overlay.LoadingBlocker while any open surface is still streaming, hides it otherwise
+	void UpdateLoadingBlocker();
+
+	FT66UIRouterEntry* FindOpenEntry(const FGameplayTag& SurfaceTag);
+	int32 GetZOrderForEntry(const FT66UIRouterEntry& Entry) const;
+	UUserWidget* TakeCachedWidget(const FGameplayTag& SurfaceTag);
+	void TrimCache(ET66UISurfaceType SurfaceType);
+
+	TSoftClassPtr<UUserWidget> FindSurfaceClass(const FGameplayTag& SurfaceTag) const;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UT66UISurfaceRegistryDataAsset> LoadedRegistry = nullptr;
+
+	// Screens + Modals, bottom to top
+	UPROPERTY(Transient)
+	TArray<FT66UIRouterEntry> Stack;
+
+	// Open Overlays
+	UPROPERTY(Transient)
+	TArray<FT66UIRouterEntry> Overlays;
+
+	// Closed widgets, least recently used first
+	UPROPERTY(Transient)
+	TArray<FT66UIRouterEntry> Cache;
+
+	// Loading blocker instance (not part of the stack or the overlay layer)
+	UPROPERTY(Transient)
+	TObjectPtr<UUserWidget> LoadingBlocker = nullptr;
+
+	// In-flight class loads by surface tag
+	TMap<FGameplayTag, TSharedPtr<FStreamableHandle>> PendingLoads;
+
+	TSharedPtr<FStreamableHandle> RegistryHandle;
+	TSharedPtr<FStreamableHandle> LoadingBlockerHandle;
+
+	FDelegateHandle PostLoadMapHandle;
+};
@@ -1,13 +1,62 @@
 ﻿#include "T66UIShellSubsystem.h"
 
+#include "UI/Router/T66UIRouterSubsystem.h"
+#include "UI/T66UIStats.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/StreamableManager.h"
 #include "Engine/World.h"
+#include "UObject/UObjectIterator.h"
 
 // ✅ This is where FCoreUObjectDelegates exists in UE5.x
 #include "UObject/UObjectGlobals.h"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("UI Roots"), STAT_T66UI_Roots, STATGROUP_T66UI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("UI Root Widgets"), STAT_T66UI_RootWidgets, STATGROUP_T66UI);
+
 static const TCHAR* T66_UIROOT_PATH = TEXT("/Game/Tribulation66/Content/UI/Root/WBP_UIRoot.WBP_UIRoot_C");
 
+// Assets the root needs on its first frame (loaded together with the root class)
+static const TCHAR* T66_UIROOT_CRITICAL_PATHS[] =
+{
+	TEXT("/Game/Tribulation66/Content/UI/DataAssets/Theme/DA_UITheme_Root.DA_UITheme_Root"),
+	TEXT("/Game/Tribulation66/Content/UI/DataAssets/Theme/DA_UITheme_Text.DA_UITheme_Text"),
+	TEXT("/Game/Tribulation66/Content/UI/DataAssets/Theme/DA_UITheme_Button.DA_UITheme_Button"),
+	TEXT("/Game/Tribulation66/Content/UI/DataAssets/Theme/DA_UITheme_Panel.DA_UITheme_Panel"),
+	TEXT("/Game/Tribulation66/Content/UI/DataAssets/Theme/DA_UITheme_Background.DA_UITheme_Background")
+};
+
+// Surfaces that show every player on one full-screen layout
+static const TCHAR* T66_SHARED_LAYOUT_SURFACE = TEXT("UI.Screen.HeroSelect_Coop");
+
+namespace T66UIShell
+{
+	// Counts every widget in a tree, including the trees of nested user widgets
+	static int32 CountWidgets(const UUserWidget* Widget)
+	{
+		int32 NumWidgets = 0;
+
+		if (Widget && Widget->WidgetTree)
+		{
+			Widget->WidgetTree->ForEachWidget([&NumWidgets](UWidget* Child)
+				{
+					++NumWidgets;
+
+					if (const UUserWidget* Nested = Cast<UUserWidget>(Child))
+					{
+						NumWidgets += CountWidgets(Nested);
+					}
+				});
+		}
+
+		return NumWidgets;
+	}
+}
+
 void UT66UIShellSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -18,6 +67,26 @@ void UT66UIShellSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		&UT66UIShellSubsystem::HandlePostLoadMapWithWorld
 	);
 
+	// ✅ Split-screen: players joining/leaving get/lose their root
+	LocalPlayerAddedHandle = GetGameInstance()->OnLocalPlayerAddedEvent.AddUObject(this, &UT66UIShellSubsystem::HandleLocalPlayerAdded);
+	LocalPlayerRemovedHandle = GetGameInstance()->OnLocalPlayerRemovedEvent.AddUObject(this, &UT66UIShellSubsystem::HandleLocalPlayerRemoved);
+
+	// Router tells us when shared-layout screens open/close
+	if (UT66UIRouterSubsystem* Router = Collection.InitializeDependency<UT66UIRouterSubsystem>())
+	{
+		Router->OnSurfaceChanged.AddDynamic(this, &UT66UIShellSubsystem::HandleSurfaceChanged);
+	}
+
+#if STATS
+	StatsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UT66UIShellSubsystem::HandleStatsTicker),
+		/*InDelay=*/1.0f
+	);
+#endif
+
+	// ✅ Start streaming the root now so the first playable map never waits on it
+	StartPreload();
+
 	UE_LOG(LogTemp, Display, TEXT("[T66UIShellSubsystem] Initialized"));
 }
 
@@ -29,13 +98,142 @@ void UT66UIShellSubsystem::Deinitialize()
 		PostLoadMapHandle.Reset();
 	}
 
-	SpawnedUIRoot = nullptr;
+	GetGameInstance()->OnLocalPlayerAddedEvent.Remove(LocalPlayerAddedHandle);
+	GetGameInstance()->OnLocalPlayerRemovedEvent.Remove(LocalPlayerRemovedHandle);
+	LocalPlayerAddedHandle.Reset();
+	LocalPlayerRemovedHandle.Reset();
+
+	if (StatsTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(StatsTickerHandle);
+		StatsTickerHandle.Reset();
+	}
+
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+
+	for (const FT66UIRootEntry& Entry : UIRoots)
+	{
+		DetachUIRoot(Entry);
+	}
+
+	UIRoots.Reset();
+	bWantsUIRoot = false;
+
+	if (bSharedLayout)
+	{
+		bSharedLayout = false;
+		UpdateSplitscreenLayout();
+	}
 
 	UE_LOG(LogTemp, Display, TEXT("[T66UIShellSubsystem] Deinitialized"));
 
 	Super::Deinitialize();
 }
 
+UUserWidget* UT66UIShellSubsystem::GetUIRoot() const
+{
+	return GetUIRootForPlayer(GetGameInstance()->GetFirstGamePlayer());
+}
+
+UUserWidget* UT66UIShellSubsystem::GetUIRootForPlayer(const ULocalPlayer* LocalPlayer) const
+{
+	const FT66UIRootEntry* Entry = UIRoots.FindByPredicate([LocalPlayer](const FT66UIRootEntry& Candidate) { return Candidate.LocalPlayer == LocalPlayer; });
+	return Entry ? Entry->Root.Get() : nullptr;
+}
+
+UUserWidget* UT66UIShellSubsystem::EnsureUIRootForPlayer(ULocalPlayer* LocalPlayer)
+{
+	if (!LocalPlayer)
+	{
+		return nullptr;
+	}
+
+	// ✅ One root per player — never a second one
+	if (UUserWidget* Existing = GetUIRootForPlayer(LocalPlayer))
+	{
+		return Existing;
+	}
+
+	// ✅ Never load synchronously here — the class comes from the async preload
+	UClass* RootWidgetClass = GetUIRootClass();
+	if (!RootWidgetClass)
+	{
+		// Still streaming: HandlePreloadCompleted will come back for every player
+		if (!PreloadHandle.IsValid() || PreloadHandle->HasLoadCompleted())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[T66UIShellSubsystem] WBP_UIRoot class is not loaded (bad path or failed preload): %s"), T66_UIROOT_PATH);
+		}
+
+		return nullptr;
+	}
+
+	// Owned by the GameInstance so it isn't tied to (or torn down with) any world
+	UUserWidget* RootWidget = CreateWidget<UUserWidget>(GetGameInstance(), RootWidgetClass);
+	if (!RootWidget)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIShellSubsystem] Failed to create WBP_UIRoot instance"));
+		return nullptr;
+	}
+
+	// Input/focus belong to this player (the player's controller is re-resolved after travel)
+	RootWidget->SetOwningLocalPlayer(LocalPlayer);
+
+	FT66UIRootEntry& Entry = UIRoots.AddDefaulted_GetRef();
+	Entry.LocalPlayer = LocalPlayer;
+	Entry.Root = RootWidget;
+	Entry.SlateWidget = RootWidget->TakeWidget();
+
+	AttachUIRoot(Entry);
+	UpdateSplitscreenLayout();
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIShellSubsystem] Spawned persistent WBP_UIRoot for local player %d (%d roots)"),
+		LocalPlayer->GetLocalPlayerIndex(), UIRoots.Num());
+
+	return RootWidget;
+}
+
+UClass* UT66UIShellSubsystem::GetUIRootClass() const
+{
+	return TSoftClassPtr<UUserWidget>(FSoftObjectPath(T66_UIROOT_PATH)).Get();
+}
+
+void UT66UIShellSubsystem::StartPreload()
+{
+	TArray<FSoftObjectPath> AssetsToLoad;
+	AssetsToLoad.Add(FSoftObjectPath(T66_UIROOT_PATH));
+
+	for (const TCHAR* CriticalPath : T66_UIROOT_CRITICAL_PATHS)
+	{
+		AssetsToLoad.Add(FSoftObjectPath(CriticalPath));
+	}
+
+	PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetsToLoad,
+		FStreamableDelegate::CreateUObject(this, &UT66UIShellSubsystem::HandlePreloadCompleted),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+
+	if (!PreloadHandle.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIShellSubsystem] Failed to start async preload of WBP_UIRoot at: %s"), T66_UIROOT_PATH);
+	}
+}
+
+void UT66UIShellSubsystem::HandlePreloadCompleted()
+{
+	UE_LOG(LogTemp, Display, TEXT("[T66UIShellSubsystem] Preloaded WBP_UIRoot"));
+
+	// A playable map may already be waiting on us
+	if (bWantsUIRoot)
+	{
+		SyncUIRoots();
+	}
+}
+
 void UT66UIShellSubsystem::HandlePostLoadMapWithWorld(UWorld* LoadedWorld)
 {
 	if (!LoadedWorld)
@@ -52,38 +250,172 @@ void UT66UIShellSubsystem::HandlePostLoadMapWithWorld(UWorld* LoadedWorld)
 		return;
 	}
 
-	SpawnUIRoot(LoadedWorld);
+	// Multi-client PIE: every instance gets this broadcast, only react to our own
+	if (LoadedWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	bWantsUIRoot = true;
+	SyncUIRoots();
 }
 
-void UT66UIShellSubsystem::SpawnUIRoot(UWorld* World)
+void UT66UIShellSubsystem::HandleLocalPlayerAdded(ULocalPlayer* LocalPlayer)
 {
-	if (!World)
+	if (bWantsUIRoot)
+	{
+		EnsureUIRootForPlayer(LocalPlayer);
+	}
+}
+
+void UT66UIShellSubsystem::HandleLocalPlayerRemoved(ULocalPlayer* LocalPlayer)
+{
+	const int32 Index = UIRoots.IndexOfByPredicate([LocalPlayer](const FT66UIRootEntry& Entry) { return Entry.LocalPlayer == LocalPlayer; });
+
+	if (Index != INDEX_NONE)
+	{
+		DetachUIRoot(UIRoots[Index]);
+		UIRoots.RemoveAt(Index);
+
+		UE_LOG(LogTemp, Display, TEXT("[T66UIShellSubsystem] Removed WBP_UIRoot for a leaving local player (%d roots)"), UIRoots.Num());
+	}
+}
+
+void UT66UIShellSubsystem::HandleSurfaceChanged(FGameplayTag SurfaceTag, bool bOpen)
+{
+	if (SurfaceTag != FGameplayTag::RequestGameplayTag(FName(T66_SHARED_LAYOUT_SURFACE), /*ErrorIfNotFound=*/false))
 	{
 		return;
 	}
 
-	// Only spawn once
-	if (SpawnedUIRoot)
+	if (bSharedLayout != bOpen)
+	{
+		bSharedLayout = bOpen;
+		UpdateSplitscreenLayout();
+	}
+}
+
+void UT66UIShellSubsystem::SyncUIRoots()
+{
+	for (ULocalPlayer* LocalPlayer : GetGameInstance()->GetLocalPlayers())
+	{
+		EnsureUIRootForPlayer(LocalPlayer);
+	}
+
+	// Already spawned: just make sure they're still in the viewport after travel
+	for (const FT66UIRootEntry& Entry : UIRoots)
+	{
+		AttachUIRoot(Entry);
+	}
+
+	RefuseDuplicateRoots();
+	UpdateSplitscreenLayout();
+}
+
+void UT66UIShellSubsystem::AttachUIRoot(const FT66UIRootEntry& Entry)
+{
+	UGameViewportClient* ViewportClient = GetGameInstance()->GetGameViewportClient();
+	if (!ViewportClient || !Entry.LocalPlayer || !Entry.SlateWidget.IsValid())
 	{
 		return;
 	}
 
-	UClass* RootWidgetClass = StaticLoadClass(UUserWidget::StaticClass(), nullptr, T66_UIROOT_PATH);
-	if (!RootWidgetClass)
+	// Remove first so re-attaching after travel never duplicates the slot
+	ViewportClient->RemoveViewportWidgetForPlayer(Entry.LocalPlayer, Entry.SlateWidget.ToSharedRef());
+	ViewportClient->AddViewportWidgetForPlayer(Entry.LocalPlayer, Entry.SlateWidget.ToSharedRef(), /*ZOrder=*/0);
+}
+
+void UT66UIShellSubsystem::DetachUIRoot(const FT66UIRootEntry& Entry)
+{
+	UGameViewportClient* ViewportClient = GetGameInstance() ? GetGameInstance()->GetGameViewportClient() : nullptr;
+	if (!ViewportClient || !Entry.LocalPlayer || !Entry.SlateWidget.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("[T66UIShellSubsystem] Failed to load WBP_UIRoot class at: %s"), T66_UIROOT_PATH);
 		return;
 	}
 
-	UUserWidget* RootWidget = CreateWidget<UUserWidget>(World, RootWidgetClass);
-	if (!RootWidget)
+	ViewportClient->RemoveViewportWidgetForPlayer(Entry.LocalPlayer, Entry.SlateWidget.ToSharedRef());
+}
+
+void UT66UIShellSubsystem::RefuseDuplicateRoots()
+{
+	UClass* RootWidgetClass = GetUIRootClass();
+	if (!RootWidgetClass)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[T66UIShellSubsystem] Failed to create WBP_UIRoot instance"));
 		return;
 	}
 
-	RootWidget->AddToViewport(/*ZOrder=*/0);
-	SpawnedUIRoot = RootWidget;
+	// Two root trees double Slate prepass + paint: anything we didn't create has to go
+	for (TObjectIterator<UUserWidget> It; It; ++It)
+	{
+		UUserWidget* Widget = *It;
+
+		if (!Widget->IsA(RootWidgetClass) || Widget->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+		{
+			continue;
+		}
+
+		if (Widget->GetGameInstance() != GetGameInstance() || !Widget->IsInViewport())
+		{
+			continue;
+		}
+
+		if (UIRoots.ContainsByPredicate([Widget](const FT66UIRootEntry& Entry) { return Entry.Root == Widget; }))
+		{
+			continue;
+		}
+
+		UE_LOG(LogTemp, Error, TEXT("[T66UIShellSubsystem] Refusing duplicate UI root %s (outer: %s). UT66UIShellSubsystem owns WBP_UIRoot."),
+			*GetNameSafe(Widget), *GetNameSafe(Widget->GetOuter()));
+
+		Widget->RemoveFromParent();
+	}
+}
+
+void UT66UIShellSubsystem::UpdateSplitscreenLayout()
+{
+	if (UGameViewportClient* ViewportClient = GetGameInstance() ? GetGameInstance()->GetGameViewportClient() : nullptr)
+	{
+		ViewportClient->SetForceDisableSplitscreen(bSharedLayout);
+	}
+
+	// Shared layout: the primary root covers the whole screen, the others would just paint the same space again
+	const ULocalPlayer* PrimaryPlayer = GetGameInstance() ? GetGameInstance()->GetFirstGamePlayer() : nullptr;
+
+	for (FT66UIRootEntry& Entry : UIRoots)
+	{
+		if (!Entry.Root)
+		{
+			continue;
+		}
+
+		const bool bCollapse = bSharedLayout && Entry.LocalPlayer != PrimaryPlayer;
+
+		if (bCollapse && !Entry.VisibilityBeforeSharedLayout.IsSet())
+		{
+			Entry.VisibilityBeforeSharedLayout = Entry.Root->GetVisibility();
+			Entry.Root->SetVisibility(ESlateVisibility::Collapsed);
+		}
+		else if (!bCollapse && Entry.VisibilityBeforeSharedLayout.IsSet())
+		{
+			Entry.Root->SetVisibility(Entry.VisibilityBeforeSharedLayout.GetValue());
+			Entry.VisibilityBeforeSharedLayout.Reset();
+		}
+	}
+}
+
+bool UT66UIShellSubsystem::HandleStatsTicker(float DeltaTime)
+{
+#if STATS
+	int32 NumRootWidgets = 0;
+
+	for (const FT66UIRootEntry& Entry : UIRoots)
+	{
+		NumRootWidgets += T66UIShell::CountWidgets(Entry.Root);
+	}
+
+	SET_DWORD_STAT(STAT_T66UI_Roots, UIRoots.Num());
+	SET_DWORD_STAT(STAT_T66UI_RootWidgets, NumRootWidgets);
+#endif
 
-	UE_LOG(LogTemp, Display, TEXT("[T66UIShellSubsystem] Spawned WBP_UIRoot into viewport"));
+	return true;
 }
@@ -2,14 +2,43 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Containers/Ticker.h"
+#include "Components/SlateWrapperTypes.h"
 #include "T66UIShellSubsystem.generated.h"
 
+class SWidget;
+class ULocalPlayer;
 class UUserWidget;
+struct FStreamableHandle;
+
+/** One local player's UI root */
+USTRUCT()
+struct FT66UIRootEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<ULocalPlayer> LocalPlayer = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UUserWidget> Root = nullptr;
+
+	// Slate widget we added to the player's viewport layer (re-added after travel)
+	TSharedPtr<SWidget> SlateWidget;
+
+	// Visibility to restore when a shared layout stops collapsing this (secondary) root
+	TOptional<ESlateVisibility> VisibilityBeforeSharedLayout;
+};
 
 /**
  * UT66UIShellSubsystem
- * - Auto-spawns WBP_UIRoot at runtime (PIE/Game)
- * - No manual level wiring required
+ * - THE UI root authority: exactly one WBP_UIRoot per local player, nothing else creates roots
+ * - Async preloads WBP_UIRoot + its critical assets at Initialize (never blocks a map load)
+ * - Roots are owned by the GameInstance (not a world) and added to each player's split-screen region, so they survive travel
+ * - Refuses duplicates: any other WBP_UIRoot found in the viewport is removed (and logged)
+ * - UI.Screen.HeroSelect_Coop switches to a shared full-screen layout (split-screen off, secondary roots collapsed)
+ * - "stat T66UI" shows live root + root widget counts
  */
 UCLASS()
 class T66_API UT66UIShellSubsystem : public UGameInstanceSubsystem
@@ -20,18 +49,73 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// Root of the primary local player (null until the preload finished and a playable map loaded)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Shell")
+	UUserWidget* GetUIRoot() const;
+
+	// Root of a given local player (null if it doesn't have one yet)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Shell")
+	UUserWidget* GetUIRootForPlayer(const ULocalPlayer* LocalPlayer) const;
+
+	// Returns the player's root, creating it if the class is loaded (null while still preloading — it's created when ready)
+	UUserWidget* EnsureUIRootForPlayer(ULocalPlayer* LocalPlayer);
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Shell")
+	int32 GetNumUIRoots() const { return UIRoots.Num(); }
+
+	// The WBP_UIRoot class (null until preloaded)
+	UClass* GetUIRootClass() const;
+
 private:
+	// Kicks off the async load of the root class + critical dependencies
+	void StartPreload();
+
+	// Called when the async preload finishes
+	void HandlePreloadCompleted();
+
 	// Called after a map finishes loading
 	void HandlePostLoadMapWithWorld(UWorld* LoadedWorld);
 
-	// Actually creates + adds UIRoot to viewport
-	void SpawnUIRoot(UWorld* World);
+	void HandleLocalPlayerAdded(ULocalPlayer* LocalPlayer);
+	void HandleLocalPlayerRemoved(ULocalPlayer* LocalPlayer);
+
+	// Router hook: switches the shared layout for UI.Screen.HeroSelect_Coop
+	UFUNCTION()
+	void HandleSurfaceChanged(FGameplayTag SurfaceTag, bool bOpen);
+
+	// One root per local player, attached to the viewport, duplicates refused
+	void SyncUIRoots();
+
+	// (Re)adds a root's slate widget to its player's viewport region (safe to call repeatedly)
+	void AttachUIRoot(const FT66UIRootEntry& Entry);
+	void DetachUIRoot(const FT66UIRootEntry& Entry);
+
+	// Removes any WBP_UIRoot in our viewport that we didn't create
+	void RefuseDuplicateRoots();
+
+	// Applies the shared/split layout to the viewport and the secondary roots
+	void UpdateSplitscreenLayout();
+
+	// Refreshes the stat counters (once a second while stats are compiled in)
+	bool HandleStatsTicker(float DeltaTime);
 
 private:
-	// Tracks our spawned root widget (so we only spawn once)
+	// One entry per local player with a root
 	UPROPERTY(Transient)
-	TObjectPtr<UUserWidget> SpawnedUIRoot = nullptr;
+	TArray<FT66UIRootEntry> UIRoots;
+
+	// Keeps the preloaded assets resident for the lifetime of the GameInstance
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	// True once a playable map loaded (so the preload callback knows to spawn)
+	bool bWantsUIRoot = false;
+
+	// True while a surface that needs one full-screen layout for all players is open
+	bool bSharedLayout = false;
 
-	// Delegate handle so we can cleanly unhook
+	// Delegate handles so we can cleanly unhook
 	FDelegateHandle PostLoadMapHandle;
+	FDelegateHandle LocalPlayerAddedHandle;
+	FDelegateHandle LocalPlayerRemovedHandle;
+	FTSTicker::FDelegateHandle StatsTickerHandle;
 };
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// "stat T66UI" — live UI counters (roots, widgets, ...) and per-surface prepass/paint cost (see FT66UISurfaceStats)
+DECLARE_STATS_GROUP(TEXT("T66 UI"), STATGROUP_T66UI, STATCAT_Advanced);
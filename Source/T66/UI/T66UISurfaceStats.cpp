@@ -0,0 +1,469 @@
+#include "UI/T66UISurfaceStats.h"
+
+#include "UI/T66UIStats.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "Blueprint/WidgetTree.h"
+#include "Debugging/SlateDebugging.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Types/ISlateMetaData.h"
+#include "Widgets/SCompoundWidget.h"
+
+CSV_DEFINE_CATEGORY(T66UI, true);
+
+UE_TRACE_CHANNEL_DEFINE(T66UIChannel);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Surfaces"), STAT_T66UI_LiveSurfaces, STATGROUP_T66UI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Surface Invalidations (frame)"), STAT_T66UI_SurfaceInvalidations, STATGROUP_T66UI);
+
+bool FT66UISurfaceStats::bEnabled = false;
+
+namespace T66UISurfaceStats
+{
+	/** Accumulated cost of one surface (all its instances) */
+	struct FSurfaceCost
+	{
+		FString Name;
+
+		int32 LiveInstances = 0;
+		int32 NumWidgets = 0;
+
+		double LastConstructMs = 0.0;
+		double MaxConstructMs = 0.0;
+		uint32 NumConstructs = 0;
+
+		// This frame, flushed at end of frame
+		uint64 FramePrepassCycles = 0;
+		uint64 FramePaintCycles = 0;
+		uint32 FrameInvalidations = 0;
+
+		double TotalPrepassMs = 0.0;
+		double TotalPaintMs = 0.0;
+		double MaxFrameMs = 0.0;
+		uint64 TotalInvalidations = 0;
+		uint32 FramesActive = 0;
+
+#if STATS
+		TStatId PrepassStatId;
+		TStatId PaintStatId;
+#endif
+
+#if CSV_PROFILER
+		FName CsvPrepassName;
+		FName CsvPaintName;
+		FName CsvInvalidationsName;
+#endif
+	};
+
+	TMap<FGameplayTag, FSurfaceCost> Surfaces;
+
+	FDelegateHandle EndFrameHandle;
+
+#if WITH_SLATE_DEBUGGING
+	FDelegateHandle InvalidateHandle;
+#endif
+
+	FSurfaceCost& FindOrAddSurface(const FGameplayTag& SurfaceID)
+	{
+		if (FSurfaceCost* Existing = Surfaces.Find(SurfaceID))
+		{
+			return *Existing;
+		}
+
+		FSurfaceCost& Cost = Surfaces.Add(SurfaceID);
+		Cost.Name = SurfaceID.ToString();
+
+#if STATS
+		Cost.PrepassStatId = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_T66UI>(Cost.Name + TEXT(" Prepass"));
+		Cost.PaintStatId = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_T66UI>(Cost.Name + TEXT(" Paint"));
+#endif
+
+#if CSV_PROFILER
+		Cost.CsvPrepassName = FName(*(Cost.Name + TEXT("/PrepassMs")));
+		Cost.CsvPaintName = FName(*(Cost.Name + TEXT("/PaintMs")));
+		Cost.CsvInvalidationsName = FName(*(Cost.Name + TEXT("/Invalidations")));
+#endif
+
+		return Cost;
+	}
+
+	/** Counts a surface's widgets, including the trees of the user widgets it contains */
+	int32 CountWidgets(const UUserWidget* Widget)
+	{
+		int32 NumWidgets = 0;
+
+		if (Widget && Widget->WidgetTree)
+		{
+			Widget->WidgetTree->ForEachWidget([&NumWidgets](UWidget* Child)
+			{
+				++NumWidgets;
+
+				if (const UUserWidget* ChildUserWidget = Cast<UUserWidget>(Child))
+				{
+					NumWidgets += CountWidgets(ChildUserWidget);
+				}
+			});
+		}
+
+		return NumWidgets;
+	}
+
+	/** Tags a scope widget with its surface, so invalidations found by walking up the parents can be attributed */
+	class FT66SurfaceStatsMetaData : public ISlateMetaData
+	{
+	public:
+		SLATE_METADATA_TYPE(FT66SurfaceStatsMetaData, ISlateMetaData)
+
+		explicit FT66SurfaceStatsMetaData(const FGameplayTag& InSurfaceID)
+			: SurfaceID(InSurfaceID)
+		{
+		}
+
+		FGameplayTag SurfaceID;
+	};
+
+	/** Wraps a surface's content: times the prepass and paint of everything under it while collection is on */
+	class ST66SurfaceStatsScope : public SCompoundWidget
+	{
+	public:
+		SLATE_BEGIN_ARGS(ST66SurfaceStatsScope) {}
+			SLATE_DEFAULT_SLOT(FArguments, Content)
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const FGameplayTag& InSurfaceID)
+		{
+			SurfaceID = InSurfaceID;
+
+			const FSurfaceCost& Cost = FindOrAddSurface(SurfaceID);
+			TraceName = Cost.Name;
+
+#if STATS
+			PrepassStatId = Cost.PrepassStatId;
+			PaintStatId = Cost.PaintStatId;
+#endif
+
+			AddMetadata(MakeShared<FT66SurfaceStatsMetaData>(SurfaceID));
+
+			// Takes over the child prepass so it can be timed
+			bHasCustomPrepass = true;
+
+			ChildSlot
+			[
+				InArgs._Content.Widget
+			];
+		}
+
+		virtual bool CustomPrepass(float LayoutScaleMultiplier) override
+		{
+			// Turned off after this surface was built: let Slate prepass the children as usual
+			if (!FT66UISurfaceStats::IsEnabled())
+			{
+				return true;
+			}
+
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*TraceName, T66UIChannel);
+#if STATS
+			FScopeCycleCounter CycleCounter(PrepassStatId);
+#endif
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			const TSharedRef<SWidget>& Child = ChildSlot.GetWidget();
+			if (Child->GetVisibility() != EVisibility::Collapsed)
+			{
+				Child->SlatePrepass(LayoutScaleMultiplier);
+			}
+
+			if (FSurfaceCost* Cost = Surfaces.Find(SurfaceID))
+			{
+				Cost->FramePrepassCycles += FPlatformTime::Cycles64() - StartCycles;
+			}
+
+			// Children are done
+			return false;
+		}
+
+		virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+			FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+		{
+			if (!FT66UISurfaceStats::IsEnabled())
+			{
+				return SCompoundWidget::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+			}
+
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*TraceName, T66UIChannel);
+#if STATS
+			FScopeCycleCounter CycleCounter(PaintStatId);
+#endif
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			const int32 MaxLayerId = SCompoundWidget::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+			if (FSurfaceCost* Cost = Surfaces.Find(SurfaceID))
+			{
+				Cost->FramePaintCycles += FPlatformTime::Cycles64() - StartCycles;
+			}
+
+			return MaxLayerId;
+		}
+
+	private:
+		FGameplayTag SurfaceID;
+		FString TraceName;
+
+#if STATS
+		TStatId PrepassStatId;
+		TStatId PaintStatId;
+#endif
+	};
+
+#if WITH_SLATE_DEBUGGING
+	void HandleWidgetInvalidated(const FSlateDebuggingInvalidateArgs& Args)
+	{
+		// Attribute to the closest surface above the invalidated widget (collection only, a parent walk is fine)
+		for (const SWidget* Current = Args.WidgetInvalidated; Current; Current = Current->GetParentWidget().Get())
+		{
+			if (const TSharedPtr<FT66SurfaceStatsMetaData> MetaData = Current->GetMetaData<FT66SurfaceStatsMetaData>())
+			{
+				if (FSurfaceCost* Cost = Surfaces.Find(MetaData->SurfaceID))
+				{
+					++Cost->FrameInvalidations;
+				}
+
+				return;
+			}
+		}
+	}
+#endif
+
+	void HandleEndFrame()
+	{
+		uint32 NumLiveSurfaces = 0;
+		uint32 NumFrameInvalidations = 0;
+
+		for (TPair<FGameplayTag, FSurfaceCost>& Surface : Surfaces)
+		{
+			FSurfaceCost& Cost = Surface.Value;
+
+			const double PrepassMs = FPlatformTime::ToMilliseconds64(Cost.FramePrepassCycles);
+			const double PaintMs = FPlatformTime::ToMilliseconds64(Cost.FramePaintCycles);
+
+			NumLiveSurfaces += Cost.LiveInstances;
+			NumFrameInvalidations += Cost.FrameInvalidations;
+
+			if (Cost.FramePrepassCycles > 0 || Cost.FramePaintCycles > 0)
+			{
+				++Cost.FramesActive;
+				Cost.TotalPrepassMs += PrepassMs;
+				Cost.TotalPaintMs += PaintMs;
+				Cost.MaxFrameMs = FMath::Max(Cost.MaxFrameMs, PrepassMs + PaintMs);
+			}
+
+			Cost.TotalInvalidations += Cost.FrameInvalidations;
+
+#if CSV_PROFILER
+			// Open surfaces only, so closed ones don't add empty columns every frame
+			if (Cost.LiveInstances > 0)
+			{
+				FCsvProfiler::RecordCustomStat(Cost.CsvPrepassName, CSV_CATEGORY_INDEX(T66UI), float(PrepassMs), ECsvCustomStatOp::Set);
+				FCsvProfiler::RecordCustomStat(Cost.CsvPaintName, CSV_CATEGORY_INDEX(T66UI), float(PaintMs), ECsvCustomStatOp::Set);
+				FCsvProfiler::RecordCustomStat(Cost.CsvInvalidationsName, CSV_CATEGORY_INDEX(T66UI), int32(Cost.FrameInvalidations), ECsvCustomStatOp::Set);
+			}
+#endif
+
+			Cost.FramePrepassCycles = 0;
+			Cost.FramePaintCycles = 0;
+			Cost.FrameInvalidations = 0;
+		}
+
+		SET_DWORD_STAT(STAT_T66UI_LiveSurfaces, NumLiveSurfaces);
+		SET_DWORD_STAT(STAT_T66UI_SurfaceInvalidations, NumFrameInvalidations);
+	}
+
+	void UpdateCollection(bool bEnabled)
+	{
+		if (bEnabled && !EndFrameHandle.IsValid())
+		{
+			EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&HandleEndFrame);
+
+#if WITH_SLATE_DEBUGGING
+			InvalidateHandle = FSlateDebugging::WidgetInvalidateEvent.AddStatic(&HandleWidgetInvalidated);
+#endif
+		}
+		else if (!bEnabled && EndFrameHandle.IsValid())
+		{
+			FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+			EndFrameHandle.Reset();
+
+#if WITH_SLATE_DEBUGGING
+			FSlateDebugging::WidgetInvalidateEvent.Remove(InvalidateHandle);
+			InvalidateHandle.Reset();
+#endif
+
+			// Drop the unfinished frame so it isn't added to the next frame after collection is turned back on
+			for (TPair<FGameplayTag, FSurfaceCost>& Surface : Surfaces)
+			{
+				Surface.Value.FramePrepassCycles = 0;
+				Surface.Value.FramePaintCycles = 0;
+				Surface.Value.FrameInvalidations = 0;
+			}
+		}
+	}
+}
+
+TSharedRef<SWidget> FT66UISurfaceStats::WrapSurfaceContent(const FGameplayTag& SurfaceID, const TSharedRef<SWidget>& Content)
+{
+	if (!bEnabled || !SurfaceID.IsValid())
+	{
+		return Content;
+	}
+
+	return SNew(T66UISurfaceStats::ST66SurfaceStatsScope, SurfaceID)
+		[
+			Content
+		];
+}
+
+void FT66UISurfaceStats::RegisterSurface(const UT66WidgetBase* Widget, double ConstructMs)
+{
+	if (!bEnabled || !Widget || !Widget->SurfaceID.IsValid())
+	{
+		return;
+	}
+
+	using namespace T66UISurfaceStats;
+
+	FSurfaceCost& Cost = FindOrAddSurface(Widget->SurfaceID);
+
+	++Cost.LiveInstances;
+	++Cost.NumConstructs;
+	Cost.NumWidgets = CountWidgets(Widget);
+	Cost.LastConstructMs = ConstructMs;
+	Cost.MaxConstructMs = FMath::Max(Cost.MaxConstructMs, ConstructMs);
+
+	TRACE_BOOKMARK(TEXT("T66UI Construct %s (%.2f ms, %d widgets)"), *Cost.Name, ConstructMs, Cost.NumWidgets);
+}
+
+void FT66UISurfaceStats::UnregisterSurface(const UT66WidgetBase* Widget)
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	if (T66UISurfaceStats::FSurfaceCost* Cost = T66UISurfaceStats::Surfaces.Find(Widget->SurfaceID))
+	{
+		Cost->LiveInstances = FMath::Max(0, Cost->LiveInstances - 1);
+	}
+}
+
+void FT66UISurfaceStats::DumpCSV()
+{
+	using namespace T66UISurfaceStats;
+
+	// Most expensive first
+	TArray<const TPair<FGameplayTag, FSurfaceCost>*> Sorted;
+	for (const TPair<FGameplayTag, FSurfaceCost>& Surface : Surfaces)
+	{
+		Sorted.Add(&Surface);
+	}
+
+	Sorted.Sort([](const TPair<FGameplayTag, FSurfaceCost>& A, const TPair<FGameplayTag, FSurfaceCost>& B)
+	{
+		return (A.Value.TotalPrepassMs + A.Value.TotalPaintMs) > (B.Value.TotalPrepassMs + B.Value.TotalPaintMs);
+	});
+
+	TStringBuilder<4096> Csv;
+
+	// header
+	Csv << TEXT("Surface,LiveInstances,Widgets,Constructs,LastConstructMs,MaxConstructMs,FramesActive,AvgPrepassMs,AvgPaintMs,MaxFrameMs,TotalMs,Invalidations,InvalidationsPerFrame");
+	Csv << LINE_TERMINATOR;
+
+	// one row per surface
+	for (const TPair<FGameplayTag, FSurfaceCost>* Surface : Sorted)
+	{
+		const FSurfaceCost& Cost = Surface->Value;
+		const double Frames = FMath::Max(1.0, double(Cost.FramesActive));
+
+		Csv.Appendf(TEXT("%s,%d,%d,%u,%.3f,%.3f,%u,%.4f,%.4f,%.4f,%.3f,%llu,%.2f"),
+			*Cost.Name,
+			Cost.LiveInstances,
+			Cost.NumWidgets,
+			Cost.NumConstructs,
+			Cost.LastConstructMs,
+			Cost.MaxConstructMs,
+			Cost.FramesActive,
+			Cost.TotalPrepassMs / Frames,
+			Cost.TotalPaintMs / Frames,
+			Cost.MaxFrameMs,
+			Cost.TotalPrepassMs + Cost.TotalPaintMs,
+			Cost.TotalInvalidations,
+			double(Cost.TotalInvalidations) / Frames);
+
+		Csv << LINE_TERMINATOR;
+	}
+
+	const FString FilePath = FPaths::ProfilingDir() / TEXT("T66") / FString::Printf(TEXT("UISurfaces-%s.csv"), *FDateTime::Now().ToString());
+
+	if (FFileHelper::SaveStringToFile(Csv.ToView(), *FilePath))
+	{
+		UE_LOG(LogTemp, Display, TEXT("[T66UISurfaceStats] Surface costs written to %s"), *FilePath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UISurfaceStats] Could not write surface costs to %s"), *FilePath);
+	}
+}
+
+void FT66UISurfaceStats::Reset()
+{
+	for (TPair<FGameplayTag, T66UISurfaceStats::FSurfaceCost>& Surface : T66UISurfaceStats::Surfaces)
+	{
+		T66UISurfaceStats::FSurfaceCost& Cost = Surface.Value;
+
+		Cost.LastConstructMs = 0.0;
+		Cost.MaxConstructMs = 0.0;
+		Cost.NumConstructs = 0;
+		Cost.TotalPrepassMs = 0.0;
+		Cost.TotalPaintMs = 0.0;
+		Cost.MaxFrameMs = 0.0;
+		Cost.TotalInvalidations = 0;
+		Cost.FramesActive = 0;
+	}
+}
+
+/** Console bindings for the surface cost instrumentation */
+struct FT66UISurfaceStatsConsole
+{
+	static void OnEnableChanged(IConsoleVariable* Variable)
+	{
+		T66UISurfaceStats::UpdateCollection(FT66UISurfaceStats::bEnabled);
+	}
+
+	static inline FAutoConsoleVariableRef CVarEnable{
+		TEXT("t66.UI.SurfaceStats"),
+		FT66UISurfaceStats::bEnabled,
+		TEXT("If true, records per-surface construct time, widget count, prepass/paint time and invalidations (stat T66UI, CSV profiler, T66UI trace channel). Surfaces built while it's off aren't measured."),
+		FConsoleVariableDelegate::CreateStatic(&FT66UISurfaceStatsConsole::OnEnableChanged),
+		ECVF_Cheat
+	};
+};
+
+static FAutoConsoleCommand CCmdT66UISurfaceStatsDumpCSV(
+	TEXT("t66.UI.SurfaceStats.DumpCSV"),
+	TEXT("Writes the per-surface UI costs to Saved/Profiling/T66."),
+	FConsoleCommandDelegate::CreateStatic(&FT66UISurfaceStats::DumpCSV)
+);
+
+static FAutoConsoleCommand CCmdT66UISurfaceStatsReset(
+	TEXT("t66.UI.SurfaceStats.Reset"),
+	TEXT("Clears the accumulated per-surface UI costs."),
+	FConsoleCommandDelegate::CreateStatic(&FT66UISurfaceStats::Reset)
+);
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class SWidget;
+class UT66WidgetBase;
+struct FGameplayTag;
+
+/**
+ * Per-surface UI cost instrumentation (Screens, Modals, Overlays, Tooltips — keyed by SurfaceID).
+ * - UT66WidgetBase registers every live surface with its construct time (Slate rebuild + Construct) and widget count
+ * - Surface content is wrapped in a scope widget that attributes Slate prepass + paint time to the surface
+ * - Invalidations under a surface are counted (needs Slate debugging, non-shipping)
+ * Results: "stat T66UI" (one prepass/paint cycle stat per surface), the T66UI trace channel in Unreal Insights
+ * (-trace=cpu,T66UI), CSV profiler columns (T66UI category) and t66.UI.SurfaceStats.DumpCSV.
+ * Disabled by default (t66.UI.SurfaceStats). Surfaces are wrapped when they're built, so enable it before opening them.
+ */
+class T66_API FT66UISurfaceStats
+{
+public:
+	/** Returns true if surface costs are being collected */
+	static FORCEINLINE bool IsEnabled() { return bEnabled; }
+
+	/** Wraps a surface's Slate content so its prepass/paint are attributed to it. Returns Content untouched when disabled. */
+	static TSharedRef<SWidget> WrapSurfaceContent(const FGameplayTag& SurfaceID, const TSharedRef<SWidget>& Content);
+
+	/** Called by UT66WidgetBase once a surface is constructed */
+	static void RegisterSurface(const UT66WidgetBase* Widget, double ConstructMs);
+
+	/** Called by UT66WidgetBase when a registered surface is destructed */
+	static void UnregisterSurface(const UT66WidgetBase* Widget);
+
+	/** Writes the per-surface summary to a CSV file in the profiling directory */
+	static void DumpCSV();
+
+	/** Clears every accumulated cost (live instance counts are kept) */
+	static void Reset();
+
+private:
+	/** Collection toggle, bound to t66.UI.SurfaceStats */
+	static bool bEnabled;
+
+	friend struct FT66UISurfaceStatsConsole;
+};
@@ -0,0 +1,299 @@
+#include "UI/Theme/T66UIThemeSubsystem.h"
+
+#include "UI/Registry/T66UIThemeDA.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "Components/TextBlock.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+namespace T66UIThemeSubsystem
+{
+	// Prefixes a token with its asset's namespace (unless it already carries it)
+	static FName QualifyToken(const UT66UIThemeDA& Theme, FName TokenName)
+	{
+		if (Theme.TokenNamespace.IsNone())
+		{
+			return TokenName;
+		}
+
+		const FString Prefix = Theme.TokenNamespace.ToString() + TEXT(".");
+		const FString Name = TokenName.ToString();
+
+		return Name.StartsWith(Prefix) ? TokenName : FName(*(Prefix + Name));
+	}
+
+	// Remembers which asset defined a token and warns when another one silently overrides it
+	static void TrackTokenOwner(TMap<FName, const UT66UIThemeDA*>& Owners, FName TokenName, const UT66UIThemeDA& Theme, const UT66UIThemeDA* BaseTheme, const TCHAR* TypeName)
+	{
+		const UT66UIThemeDA*& Owner = Owners.FindOrAdd(TokenName);
+
+		// The base layer exists to be overridden; variants opt in to overriding
+		if (Owner && Owner != &Theme && Owner != BaseTheme && !Theme.bOverridesEarlierTokens)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[T66UIThemeSubsystem] %s token '%s' from %s overrides %s. Set a TokenNamespace on one of them, or bOverridesEarlierTokens if intended."),
+				TypeName, *TokenName.ToString(), *Theme.GetName(), *Owner->GetName());
+		}
+
+		Owner = &Theme;
+	}
+
+	template<typename ValueType>
+	static void CompileTokens(TT66UIThemeTable<ValueType>& Table, TMap<FName, const UT66UIThemeDA*>& Owners, const TMap<FName, ValueType>& Tokens,
+		const UT66UIThemeDA& Theme, const UT66UIThemeDA* BaseTheme, const TCHAR* TypeName)
+	{
+		for (const TPair<FName, ValueType>& Token : Tokens)
+		{
+			const FName TokenName = QualifyToken(Theme, Token.Key);
+			TrackTokenOwner(Owners, TokenName, Theme, BaseTheme, TypeName);
+			Table.Set(TokenName, Token.Value);
+		}
+	}
+}
+
+void FT66UIThemeTextTokens::Resolve(UT66UIThemeSubsystem& Theme)
+{
+	ColorHandle = Theme.ResolveColorToken(ColorToken);
+	FontSizeHandle = Theme.ResolveFloatToken(FontSizeToken);
+}
+
+void FT66UIThemeTextTokens::Apply(const UT66UIThemeSubsystem& Theme, UTextBlock* TextBlock) const
+{
+	if (!TextBlock)
+	{
+		return;
+	}
+
+	FLinearColor Color;
+	if (Theme.TryGetColor(ColorHandle, Color))
+	{
+		TextBlock->SetColorAndOpacity(FSlateColor(Color));
+	}
+
+	// Only touch the font when the size actually changes (SetFont invalidates layout)
+	float FontSize = 0.f;
+	if (Theme.TryGetFloat(FontSizeHandle, FontSize) && TextBlock->GetFont().Size != FMath::RoundToInt(FontSize))
+	{
+		FSlateFontInfo Font = TextBlock->GetFont();
+		Font.Size = FMath::RoundToInt(FontSize);
+		TextBlock->SetFont(Font);
+	}
+}
+
+void UT66UIThemeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+
+	for (const TSoftObjectPtr<UT66UIThemeDA>& ThemeAsset : ThemeAssets)
+	{
+		if (!ThemeAsset.IsNull())
+		{
+			AssetsToLoad.Add(ThemeAsset.ToSoftObjectPath());
+		}
+	}
+
+	if (AssetsToLoad.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIThemeSubsystem] No ThemeAssets configured. Theme tokens will use defaults."));
+		return;
+	}
+
+	LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetsToLoad,
+		FStreamableDelegate::CreateUObject(this, &UT66UIThemeSubsystem::HandleThemeAssetsLoaded),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIThemeSubsystem] Initialized"));
+}
+
+void UT66UIThemeSubsystem::Deinitialize()
+{
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->CancelHandle();
+		LoadHandle.Reset();
+	}
+
+	ThemedWidgets.Reset();
+	CompiledAssets.Reset();
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIThemeSubsystem] Deinitialized"));
+
+	Super::Deinitialize();
+}
+
+void UT66UIThemeSubsystem::ApplyTheme(const TArray<UT66UIThemeDA*>& NewThemeAssets)
+{
+	CompileTheme(NewThemeAssets);
+
+	// Values changed in place: themed widgets re-read their handles and repaint, nothing is reconstructed
+	for (int32 Index = ThemedWidgets.Num() - 1; Index >= 0; --Index)
+	{
+		if (UT66WidgetBase* Widget = ThemedWidgets[Index].Get())
+		{
+			Widget->NativeThemeChanged();
+		}
+		else
+		{
+			ThemedWidgets.RemoveAtSwap(Index);
+		}
+	}
+
+	OnThemeChanged.Broadcast();
+}
+
+FT66UIThemeTokenHandle UT66UIThemeSubsystem::ResolveColorToken(FName TokenName)
+{
+	return ResolveToken(Colors, TokenName, TEXT("Color"));
+}
+
+FT66UIThemeTokenHandle UT66UIThemeSubsystem::ResolveFloatToken(FName TokenName)
+{
+	return ResolveToken(Floats, TokenName, TEXT("Float"));
+}
+
+FT66UIThemeTokenHandle UT66UIThemeSubsystem::ResolveMarginToken(FName TokenName)
+{
+	return ResolveToken(Margins, TokenName, TEXT("Margin"));
+}
+
+FT66UIThemeTokenHandle UT66UIThemeSubsystem::ResolveVector2Token(FName TokenName)
+{
+	return ResolveToken(Vector2s, TokenName, TEXT("Vector2"));
+}
+
+void UT66UIThemeSubsystem::GetSoundGroupPaths(FName GroupName, TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (const TArray<FName>* Tokens = SoundGroups.Find(GroupName))
+	{
+		for (const FName& TokenName : *Tokens)
+		{
+			const TSoftObjectPtr<USoundBase> Sound = SoundTokens.FindRef(TokenName);
+
+			if (!Sound.IsNull())
+			{
+				OutPaths.AddUnique(Sound.ToSoftObjectPath());
+			}
+		}
+	}
+}
+
+void UT66UIThemeSubsystem::RegisterThemedWidget(UT66WidgetBase* Widget)
+{
+	if (Widget)
+	{
+		ThemedWidgets.AddUnique(Widget);
+	}
+}
+
+void UT66UIThemeSubsystem::UnregisterThemedWidget(UT66WidgetBase* Widget)
+{
+	ThemedWidgets.RemoveSwap(Widget);
+}
+
+void UT66UIThemeSubsystem::HandleThemeAssetsLoaded()
+{
+	TArray<UT66UIThemeDA*> LoadedAssets;
+
+	for (const TSoftObjectPtr<UT66UIThemeDA>& ThemeAsset : ThemeAssets)
+	{
+		if (UT66UIThemeDA* Loaded = ThemeAsset.Get())
+		{
+			LoadedAssets.Add(Loaded);
+		}
+		else if (!ThemeAsset.IsNull())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[T66UIThemeSubsystem] Failed to load theme asset: %s"), *ThemeAsset.ToString());
+		}
+	}
+
+	ApplyTheme(LoadedAssets);
+}
+
+void UT66UIThemeSubsystem::CompileTheme(const TArray<UT66UIThemeDA*>& Assets)
+{
+	Colors.ResetValues();
+	Floats.ResetValues();
+	Margins.ResetValues();
+	Vector2s.ResetValues();
+	SoundTokens.Reset();
+	SoundGroups.Reset();
+
+	CompiledAssets.Reset(Assets.Num());
+
+	// Which asset defined each token, per type (only used to report collisions)
+	TMap<FName, const UT66UIThemeDA*> ColorOwners;
+	TMap<FName, const UT66UIThemeDA*> FloatOwners;
+	TMap<FName, const UT66UIThemeDA*> MarginOwners;
+	TMap<FName, const UT66UIThemeDA*> Vector2Owners;
+	TMap<FName, const UT66UIThemeDA*> SoundOwners;
+
+	const UT66UIThemeDA* BaseTheme = nullptr;
+
+	// Later assets override earlier ones
+	for (UT66UIThemeDA* Theme : Assets)
+	{
+		if (!Theme)
+		{
+			continue;
+		}
+
+		CompiledAssets.Add(Theme);
+
+		if (!BaseTheme)
+		{
+			BaseTheme = Theme;
+		}
+
+		T66UIThemeSubsystem::CompileTokens(Colors, ColorOwners, Theme->ColorTokens, *Theme, BaseTheme, TEXT("Color"));
+		T66UIThemeSubsystem::CompileTokens(Floats, FloatOwners, Theme->FloatTokens, *Theme, BaseTheme, TEXT("Float"));
+		T66UIThemeSubsystem::CompileTokens(Margins, MarginOwners, Theme->MarginTokens, *Theme, BaseTheme, TEXT("Margin"));
+		T66UIThemeSubsystem::CompileTokens(Vector2s, Vector2Owners, Theme->Vector2Tokens, *Theme, BaseTheme, TEXT("Vector2"));
+
+		for (const TPair<FName, TSoftObjectPtr<USoundBase>>& Token : Theme->SoundTokens)
+		{
+			const FName TokenName = T66UIThemeSubsystem::QualifyToken(*Theme, Token.Key);
+			T66UIThemeSubsystem::TrackTokenOwner(SoundOwners, TokenName, *Theme, BaseTheme, TEXT("Sound"));
+			SoundTokens.Add(TokenName, Token.Value);
+		}
+
+		// Groups merge across assets (group names are shared, their entries are the asset's own tokens)
+		for (const TPair<FName, FT66UISoundGroup>& Group : Theme->SoundGroups)
+		{
+			TArray<FName>& GroupTokens = SoundGroups.FindOrAdd(Group.Key);
+
+			for (const FName& TokenName : Group.Value.Tokens)
+			{
+				GroupTokens.AddUnique(T66UIThemeSubsystem::QualifyToken(*Theme, TokenName));
+			}
+		}
+	}
+
+	++ThemeVersion;
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIThemeSubsystem] Compiled %d theme assets (v%d): %d colors | %d floats | %d margins | %d vector2s | %d sounds"),
+		CompiledAssets.Num(), ThemeVersion, Colors.Values.Num(), Floats.Values.Num(), Margins.Values.Num(), Vector2s.Values.Num(), SoundTokens.Num());
+}
+
+template<typename ValueType>
+FT66UIThemeTokenHandle UT66UIThemeSubsystem::ResolveToken(TT66UIThemeTable<ValueType>& Table, FName TokenName, const TCHAR* TypeName)
+{
+	FT66UIThemeTokenHandle Handle;
+
+	if (TokenName.IsNone())
+	{
+		return Handle;
+	}
+
+	// Unknown names still get a slot, so a later theme that defines them fills it in
+	Handle.Index = Table.FindOrAddIndex(TokenName);
+
+	if (ThemeVersion > 0 && !Table.Defined[Handle.Index])
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[T66UIThemeSubsystem] %s token '%s' is not defined by the current theme"), TypeName, *TokenName.ToString());
+	}
+
+	return Handle;
+}
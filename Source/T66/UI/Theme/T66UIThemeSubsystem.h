@@ -0,0 +1,227 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "T66UIThemeSubsystem.generated.h"
+
+class UT66UIThemeDA;
+class UT66UIThemeSubsystem;
+class UT66WidgetBase;
+class USoundBase;
+class UTextBlock;
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FT66OnUIThemeChanged);
+
+/**
+ * Stable handle to one compiled theme token.
+ * Resolve once (ex: in Construct), then read through it every time — it's just an array index.
+ */
+USTRUCT(BlueprintType)
+struct FT66UIThemeTokenHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Theme")
+	int32 Index = INDEX_NONE;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * Theme tokens styling one text block (ex: a button label, a list row title).
+ * Owners resolve the names once when themed, then re-apply on every theme change.
+ * A None name, or a token the current theme doesn't define, leaves the text block's own style alone.
+ */
+USTRUCT(BlueprintType)
+struct T66_API FT66UIThemeTextTokens
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	FName ColorToken;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	FName FontSizeToken;
+
+	void Resolve(UT66UIThemeSubsystem& Theme);
+	void Apply(const UT66UIThemeSubsystem& Theme, UTextBlock* TextBlock) const;
+
+private:
+	FT66UIThemeTokenHandle ColorHandle;
+	FT66UIThemeTokenHandle FontSizeHandle;
+};
+
+/** One compiled token type: name -> slot lookup plus a contiguous value array */
+template<typename ValueType>
+struct TT66UIThemeTable
+{
+	// Slots are never removed, so handles stay valid across theme swaps
+	TMap<FName, int32> Indices;
+	TArray<ValueType> Values;
+
+	// Which slots the current theme actually defines
+	TBitArray<> Defined;
+
+	int32 FindOrAddIndex(FName TokenName)
+	{
+		if (const int32* Existing = Indices.Find(TokenName))
+		{
+			return *Existing;
+		}
+
+		const int32 NewIndex = Values.Add(ValueType());
+		Defined.Add(false);
+		Indices.Add(TokenName, NewIndex);
+		return NewIndex;
+	}
+
+	void Set(FName TokenName, const ValueType& Value)
+	{
+		const int32 Index = FindOrAddIndex(TokenName);
+		Values[Index] = Value;
+		Defined[Index] = true;
+	}
+
+	void ResetValues()
+	{
+		for (ValueType& Value : Values)
+		{
+			Value = ValueType();
+		}
+
+		Defined.SetRange(0, Defined.Num(), false);
+	}
+
+	const ValueType& Get(int32 Index) const
+	{
+		static const ValueType Fallback = ValueType();
+		return Values.IsValidIndex(Index) ? Values[Index] : Fallback;
+	}
+
+	// False when the current theme doesn't define the slot (OutValue is left untouched)
+	bool TryGet(int32 Index, ValueType& OutValue) const
+	{
+		if (!Defined.IsValidIndex(Index) || !Defined[Index])
+		{
+			return false;
+		}
+
+		OutValue = Values[Index];
+		return true;
+	}
+};
+
+/**
+ * UT66UIThemeSubsystem
+ * - Compiles every DA_UITheme_* asset (ThemeAssets, in order) into flat typed arrays. Each asset can prefix its tokens (TokenNamespace);
+ *   the first asset is the base layer, any other cross-asset override warns unless the asset is flagged as a variant (bOverridesEarlierTokens)
+ * - Widgets resolve a token name to a FT66UIThemeTokenHandle once and then index the arrays (no TMap lookups per read)
+ * - Theme swaps only rewrite the arrays: themed UT66WidgetBase widgets get OnThemeChanged + an invalidation, never a rebuild
+ */
+UCLASS(Config = Game)
+class T66_API UT66UIThemeSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Compiles a new set of theme assets and pushes it to every themed widget
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Theme")
+	void ApplyTheme(const TArray<UT66UIThemeDA*>& NewThemeAssets);
+
+	// ----------------------------
+	// Resolve (once) -> handle
+	// Not pure: an unknown name reserves a new slot so the handle stays valid once a theme defines it
+	// ----------------------------
+
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Theme")
+	FT66UIThemeTokenHandle ResolveColorToken(FName TokenName);
+
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Theme")
+	FT66UIThemeTokenHandle ResolveFloatToken(FName TokenName);
+
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Theme")
+	FT66UIThemeTokenHandle ResolveMarginToken(FName TokenName);
+
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Theme")
+	FT66UIThemeTokenHandle ResolveVector2Token(FName TokenName);
+
+	// ----------------------------
+	// Read (every time) -> value
+	// ----------------------------
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Theme")
+	FLinearColor GetColor(FT66UIThemeTokenHandle Handle) const { return Colors.Get(Handle.Index); }
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Theme")
+	float GetFloat(FT66UIThemeTokenHandle Handle) const { return Floats.Get(Handle.Index); }
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Theme")
+	FMargin GetMargin(FT66UIThemeTokenHandle Handle) const { return Margins.Get(Handle.Index); }
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Theme")
+	FVector2D GetVector2(FT66UIThemeTokenHandle Handle) const { return Vector2s.Get(Handle.Index); }
+
+	// Same reads, but false when the current theme doesn't define the token (so callers can keep their own style)
+	bool TryGetColor(FT66UIThemeTokenHandle Handle, FLinearColor& OutColor) const { return Colors.TryGet(Handle.Index, OutColor); }
+	bool TryGetFloat(FT66UIThemeTokenHandle Handle, float& OutValue) const { return Floats.TryGet(Handle.Index, OutValue); }
+	bool TryGetMargin(FT66UIThemeTokenHandle Handle, FMargin& OutMargin) const { return Margins.TryGet(Handle.Index, OutMargin); }
+	bool TryGetVector2(FT66UIThemeTokenHandle Handle, FVector2D& OutValue) const { return Vector2s.TryGet(Handle.Index, OutValue); }
+
+	// ----------------------------
+	// Sound tokens (soft, streamed by UT66UISoundSubsystem)
+	// ----------------------------
+
+	TSoftObjectPtr<USoundBase> FindSoundToken(FName TokenName) const { return SoundTokens.FindRef(TokenName); }
+
+	// Soft paths of every sound in a group (across all compiled theme assets)
+	void GetSoundGroupPaths(FName GroupName, TArray<FSoftObjectPath>& OutPaths) const;
+
+	// Bumped on every compile (widgets can compare to skip redundant work)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Theme")
+	int32 GetThemeVersion() const { return ThemeVersion; }
+
+	// Themed widgets register on construct / unregister on destruct (see UT66WidgetBase::bThemed)
+	void RegisterThemedWidget(UT66WidgetBase* Widget);
+	void UnregisterThemedWidget(UT66WidgetBase* Widget);
+
+	UPROPERTY(BlueprintAssignable, Category = "T66|UI|Theme")
+	FT66OnUIThemeChanged OnThemeChanged;
+
+protected:
+	// Theme assets compiled at startup, in override order
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Theme")
+	TArray<TSoftObjectPtr<UT66UIThemeDA>> ThemeAssets;
+
+private:
+	void HandleThemeAssetsLoaded();
+
+	// Flattens the assets into the tables (values only — existing handles keep their slots)
+	void CompileTheme(const TArray<UT66UIThemeDA*>& Assets);
+
+	template<typename ValueType>
+	FT66UIThemeTokenHandle ResolveToken(TT66UIThemeTable<ValueType>& Table, FName TokenName, const TCHAR* TypeName);
+
+private:
+	TT66UIThemeTable<FLinearColor> Colors;
+	TT66UIThemeTable<float> Floats;
+	TT66UIThemeTable<FMargin> Margins;
+	TT66UIThemeTable<FVector2D> Vector2s;
+
+	// Sounds stay soft (never part of the value tables)
+	TMap<FName, TSoftObjectPtr<USoundBase>> SoundTokens;
+	TMap<FName, TArray<FName>> SoundGroups;
+
+	// Assets currently compiled (kept alive so a swap back is instant)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UT66UIThemeDA>> CompiledAssets;
+
+	TArray<TWeakObjectPtr<UT66WidgetBase>> ThemedWidgets;
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+
+	int32 ThemeVersion = 0;
+};
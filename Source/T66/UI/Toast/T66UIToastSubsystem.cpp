@@ -0,0 +1,465 @@
+#include "UI/Toast/T66UIToastSubsystem.h"
+
+#include "UI/Registry/T66UISurfaceRegistryDataAsset.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace T66UIToast
+{
+	static FGameplayTag ToastTag() { return FGameplayTag::RequestGameplayTag(FName(TEXT("UI.Overlay.Toast")), /*ErrorIfNotFound=*/false); }
+}
+
+void UT66UIToastSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
+		this,
+		&UT66UIToastSubsystem::HandlePostLoadMapWithWorld
+	);
+
+	if (SurfaceRegistry.IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIToastSubsystem] No UT66UISurfaceRegistryDataAsset configured (SurfaceRegistry in DefaultGame.ini). Toasts won't show."));
+	}
+	else
+	{
+		RegistryHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			SurfaceRegistry.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UT66UIToastSubsystem::HandleRegistryLoaded),
+			FStreamableManager::AsyncLoadHighPriority
+		);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIToastSubsystem] Initialized"));
+}
+
+void UT66UIToastSubsystem::Deinitialize()
+{
+	if (PostLoadMapHandle.IsValid())
+	{
+		FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+		PostLoadMapHandle.Reset();
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (RegistryHandle.IsValid())
+	{
+		RegistryHandle->CancelHandle();
+		RegistryHandle.Reset();
+	}
+
+	if (ClassHandle.IsValid())
+	{
+		ClassHandle->CancelHandle();
+		ClassHandle.Reset();
+	}
+
+	for (UUserWidget* Widget : PoolWidgets)
+	{
+		if (Widget)
+		{
+			Widget->RemoveFromParent();
+		}
+	}
+
+	Entries.Reset();
+	PoolWidgets.Reset();
+	Queue.Reset();
+	LoadedRegistry = nullptr;
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIToastSubsystem] Deinitialized"));
+
+	Super::Deinitialize();
+}
+
+void UT66UIToastSubsystem::ShowToast(const FT66ToastData& Data)
+{
+	if (Data.Message.IsEmpty() && Data.ToastKey.IsNone())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const int32 AddedCount = FMath::Max(1, Data.Count);
+
+	// ✅ Coalesce first: a burst of the same loot bumps one toast instead of queueing ten
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.State == EEntryState::Visible && IsSameToast(Entry.Data, Data))
+		{
+			Entry.Data.Count += AddedCount;
+			Entry.ExpireTime = Now + AnimDuration + (Entry.Data.Duration > 0.f ? Entry.Data.Duration : DefaultDuration);
+
+			if (UT66ToastWidgetBase* Toast = Cast<UT66ToastWidgetBase>(Entry.Widget))
+			{
+				Toast->NativeBindToast(Entry.Data);
+			}
+
+			return;
+		}
+	}
+
+	for (FT66ToastData& Queued : Queue)
+	{
+		if (IsSameToast(Queued, Data))
+		{
+			Queued.Count += AddedCount;
+			return;
+		}
+	}
+
+	if (Queue.Num() >= MaxQueuedToasts)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[T66UIToastSubsystem] Queue full, dropped oldest toast: %s"), *Queue[0].Message.ToString());
+		Queue.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+
+	FT66ToastData& Added = Queue.Add_GetRef(Data);
+	Added.Count = AddedCount;
+
+	StartTicker();
+}
+
+void UT66UIToastSubsystem::ClearToasts()
+{
+	Queue.Reset();
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.State == EEntryState::Visible)
+		{
+			StartExit(Entry);
+		}
+	}
+}
+
+void UT66UIToastSubsystem::HandleRegistryLoaded()
+{
+	LoadedRegistry = SurfaceRegistry.Get();
+
+	if (!LoadedRegistry)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UIToastSubsystem] Failed to load surface registry: %s"), *SurfaceRegistry.ToString());
+		return;
+	}
+
+	ToastClass = LoadedRegistry->SurfaceTagToWidgetClass.FindRef(T66UIToast::ToastTag());
+
+	if (ToastClass.IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIToastSubsystem] No widget class registered for UI.Overlay.Toast"));
+		return;
+	}
+
+	ClassHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ToastClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UT66UIToastSubsystem::HandleClassLoaded),
+		FStreamableManager::DefaultAsyncLoadPriority
+	);
+}
+
+void UT66UIToastSubsystem::HandleClassLoaded()
+{
+	CreatePool();
+	AttachPool();
+
+	// Anything queued while the class was streaming
+	if (Queue.Num() > 0)
+	{
+		StartTicker();
+	}
+}
+
+void UT66UIToastSubsystem::HandlePostLoadMapWithWorld(UWorld* LoadedWorld)
+{
+	// Multi-client PIE: every instance gets this broadcast, only react to our own
+	if (!LoadedWorld || LoadedWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	AttachPool();
+}
+
+void UT66UIToastSubsystem::CreatePool()
+{
+	UClass* WidgetClass = ToastClass.Get();
+	if (!WidgetClass || Entries.Num() > 0)
+	{
+		return;
+	}
+
+	if (!WidgetClass->IsChildOf(UT66ToastWidgetBase::StaticClass()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UIToastSubsystem] %s isn't a UT66ToastWidgetBase: toasts will show, but can't bind their data"), *WidgetClass->GetName());
+	}
+
+	// +1 so a new toast can enter while the oldest is still exiting
+	const int32 NumEntries = FMath::Clamp(MaxVisibleToasts, 1, 8) + 1;
+
+	PoolWidgets.Reset(NumEntries);
+	Entries.Reset(NumEntries);
+
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		// Owned by the GameInstance so the pool survives travel
+		UUserWidget* Widget = CreateWidget<UUserWidget>(GetGameInstance(), WidgetClass);
+		if (!Widget)
+		{
+			continue;
+		}
+
+		Widget->SetVisibility(ESlateVisibility::Collapsed);
+
+		PoolWidgets.Add(Widget);
+
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Widget = Widget;
+		Entry.Curve = FCurveSequence(0.f, AnimDuration, ECurveEaseFunction::Linear);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UIToastSubsystem] Created toast pool: %d entries"), Entries.Num());
+}
+
+void UT66UIToastSubsystem::AttachPool()
+{
+	const UWorld* World = GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr;
+	if (!World || !World->GetGameViewport())
+	{
+		return;
+	}
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Widget && !Entry.Widget->IsInViewport())
+		{
+			Entry.Widget->AddToViewport(ToastZOrder);
+
+			// Stacked from the top-right corner
+			Entry.Widget->SetAnchorsInViewport(FAnchors(1.f, 0.f));
+			Entry.Widget->SetAlignmentInViewport(FVector2D(1.f, 0.f));
+		}
+	}
+
+	bLayoutDirty = true;
+	LayoutEntries();
+}
+
+void UT66UIToastSubsystem::StartTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UT66UIToastSubsystem::HandleTicker)
+		);
+	}
+}
+
+bool UT66UIToastSubsystem::HandleTicker(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.State == EEntryState::Visible && Now >= Entry.ExpireTime)
+		{
+			StartExit(Entry);
+		}
+		else if (Entry.State == EEntryState::Exiting && !Entry.Curve.IsPlaying())
+		{
+			Entry.State = EEntryState::Free;
+			Entry.Data = FT66ToastData();
+
+			if (Entry.Widget)
+			{
+				Entry.Widget->SetVisibility(ESlateVisibility::Collapsed);
+			}
+
+			bLayoutDirty = true;
+		}
+	}
+
+	// Rate limited: at most one new toast per MinToastInterval
+	if (Queue.Num() > 0)
+	{
+		ShowNextQueued(Now);
+	}
+
+	LayoutEntries();
+
+	bool bActive = Queue.Num() > 0;
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.State != EEntryState::Free)
+		{
+			ApplyCurve(Entry);
+			bActive = true;
+		}
+	}
+
+	if (!bActive)
+	{
+		// Idle: returning false removes the ticker until the next toast
+		TickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool UT66UIToastSubsystem::ShowNextQueued(double Now)
+{
+	if (LastToastTime >= 0.0 && Now - LastToastTime < MinToastInterval)
+	{
+		return false;
+	}
+
+	if (GetNumVisible() >= MaxVisibleToasts)
+	{
+		return false;
+	}
+
+	FEntry* Entry = Entries.FindByPredicate([](const FEntry& Candidate) { return Candidate.State == EEntryState::Free && Candidate.Widget; });
+	if (!Entry)
+	{
+		return false;
+	}
+
+	Entry->Data = MoveTemp(Queue[0]);
+	Queue.RemoveAt(0, 1, EAllowShrinking::No);
+
+	Entry->State = EEntryState::Visible;
+	Entry->Order = NextOrder++;
+	Entry->ExpireTime = Now + AnimDuration + (Entry->Data.Duration > 0.f ? Entry->Data.Duration : DefaultDuration);
+
+	UUserWidget* Widget = Entry->Widget;
+
+	if (UT66ToastWidgetBase* Toast = Cast<UT66ToastWidgetBase>(Widget))
+	{
+		Toast->NativeBindToast(Entry->Data);
+	}
+
+	// Start fully transparent so the first painted frame is the start of the curve
+	Entry->AppliedLerp = -1.f;
+	Entry->Curve.Play(Widget->TakeWidget());
+	ApplyCurve(*Entry);
+
+	// Measured once per toast: the stack layout reuses this size until the entry is freed
+	Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+	Widget->ForceLayoutPrepass();
+	Entry->Size = Widget->GetDesiredSize();
+
+	LastToastTime = Now;
+	bLayoutDirty = true;
+
+	return true;
+}
+
+void UT66UIToastSubsystem::StartExit(FEntry& Entry)
+{
+	Entry.State = EEntryState::Exiting;
+
+	if (!Entry.Widget)
+	{
+		return;
+	}
+
+	// Cut short while still entering: run the same curve back from where it is
+	if (Entry.Curve.IsPlaying())
+	{
+		if (Entry.Curve.IsForward())
+		{
+			Entry.Curve.Reverse();
+		}
+	}
+	else
+	{
+		Entry.Curve.PlayReverse(Entry.Widget->TakeWidget());
+	}
+}
+
+void UT66UIToastSubsystem::LayoutEntries()
+{
+	if (!bLayoutDirty)
+	{
+		return;
+	}
+
+	bLayoutDirty = false;
+
+	TArray<FEntry*, TInlineAllocator<8>> Active;
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.State != EEntryState::Free && Entry.Widget)
+		{
+			Active.Add(&Entry);
+		}
+	}
+
+	Active.Sort([](const FEntry& A, const FEntry& B) { return A.Order < B.Order; });
+
+	float Y = ScreenMargin.Y;
+
+	for (FEntry* Entry : Active)
+	{
+		Entry->Widget->SetDesiredSizeInViewport(Entry->Size);
+		Entry->Widget->SetPositionInViewport(FVector2D(-ScreenMargin.X, Y), /*bRemoveDPIScale=*/false);
+
+		Y += Entry->Size.Y + EntrySpacing;
+	}
+}
+
+void UT66UIToastSubsystem::ApplyCurve(FEntry& Entry) const
+{
+	if (!Entry.Widget)
+	{
+		return;
+	}
+
+	const float Lerp = FCurveHandle::ApplyEasing(Entry.Curve.GetLerp(), ECurveEaseFunction::CubicOut);
+	if (Lerp == Entry.AppliedLerp)
+	{
+		return;
+	}
+
+	Entry.AppliedLerp = Lerp;
+
+	// Render opacity/translation only repaint, they never invalidate the stack layout
+	Entry.Widget->SetRenderOpacity(Lerp);
+	Entry.Widget->SetRenderTranslation(FVector2D((1.f - Lerp) * SlideDistance, 0.f));
+}
+
+int32 UT66UIToastSubsystem::GetNumVisible() const
+{
+	int32 NumVisible = 0;
+
+	for (const FEntry& Entry : Entries)
+	{
+		NumVisible += (Entry.State == EEntryState::Visible) ? 1 : 0;
+	}
+
+	return NumVisible;
+}
+
+bool UT66UIToastSubsystem::IsSameToast(const FT66ToastData& A, const FT66ToastData& B)
+{
+	if (!A.ToastKey.IsNone() || !B.ToastKey.IsNone())
+	{
+		return A.ToastKey == B.ToastKey;
+	}
+
+	return A.Message.EqualTo(B.Message);
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Animation/CurveSequence.h"
+#include "UI/Widgets/T66ToastWidgetBase.h"
+#include "T66UIToastSubsystem.generated.h"
+
+class UUserWidget;
+class UT66UISurfaceRegistryDataAsset;
+struct FStreamableHandle;
+
+/**
+ * UT66UIToastSubsystem
+ * - Native UI.Overlay.ToastStack: a queue of toasts shown top-right with UI.Overlay.Toast (WBP_Ov_Toast) entries
+ * - Entries come from a fixed pool created once; a toast rebinds a free entry, never creates one
+ * - Duplicates (same ToastKey/message) are coalesced into the visible or queued toast (Count goes up, lifetime restarts)
+ * - Max visible count + min interval between new toasts; a burst waits in a bounded queue (oldest dropped when full)
+ * - Enter/exit is one Slate curve per entry driving render opacity/translation (no UMG animation, no relayout)
+ */
+UCLASS(Config = Game)
+class T66_API UT66UIToastSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Queues a toast (or coalesces it into a matching one)
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Toast")
+	void ShowToast(const FT66ToastData& Data);
+
+	// Drops the queue and plays the exit of every visible toast
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Toast")
+	void ClearToasts();
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Toast")
+	int32 GetNumQueuedToasts() const { return Queue.Num(); }
+
+protected:
+	// Surface registry, set in DefaultGame.ini (always cooked as a primary asset).
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast")
+	TSoftObjectPtr<UT66UISurfaceRegistryDataAsset> SurfaceRegistry;
+
+	// Toasts on screen at once (the pool holds one extra entry so a toast can enter while another exits)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast", meta = (ClampMin = 1, ClampMax = 8))
+	int32 MaxVisibleToasts = 3;
+
+	// Toasts waiting for a free entry (oldest dropped past this)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast", meta = (ClampMin = 1))
+	int32 MaxQueuedToasts = 8;
+
+	// Min seconds between two new toasts appearing (real time)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast", meta = (ClampMin = 0))
+	float MinToastInterval = 0.2f;
+
+	// Seconds on screen when FT66ToastData::Duration is 0
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast", meta = (ClampMin = 0.1))
+	float DefaultDuration = 3.f;
+
+	// Enter (and reversed, exit) curve length
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast", meta = (ClampMin = 0.01))
+	float AnimDuration = 0.2f;
+
+	// Entries slide in from this far right (slate units)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast")
+	float SlideDistance = 48.f;
+
+	// Distance from the top-right corner, and the gap between entries (slate units)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast")
+	FVector2D ScreenMargin = FVector2D(32.f, 96.f);
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Toast")
+	float EntrySpacing = 8.f;
+
+private:
+	// Above overlays (50+), below the loading blocker (100)
+	static constexpr int32 ToastZOrder = 90;
+
+	enum class EEntryState : uint8
+	{
+		Free,
+		Visible,
+		Exiting
+	};
+
+	// One pooled entry
+	struct FEntry
+	{
+		TObjectPtr<UUserWidget> Widget = nullptr;
+		FT66ToastData Data;
+		EEntryState State = EEntryState::Free;
+		FCurveSequence Curve;
+		float AppliedLerp = -1.f;
+		double ExpireTime = 0.0;
+		uint64 Order = 0;
+		FVector2D Size = FVector2D::ZeroVector;
+	};
+
+	void HandleRegistryLoaded();
+	void HandleClassLoaded();
+	void HandlePostLoadMapWithWorld(UWorld* LoadedWorld);
+
+	void CreatePool();
+
+	// (Re)adds the pool to the viewport (entries stay collapsed until used)
+	void AttachPool();
+
+	// Runs only while something is queued or on screen
+	void StartTicker();
+	bool HandleTicker(float DeltaTime);
+
+	// Binds the oldest queued toast to a free entry, measures it and starts its enter curve
+	bool ShowNextQueued(double Now);
+
+	void StartExit(FEntry& Entry);
+
+	// Stacks visible entries top-down, oldest first (only when the set of entries changed)
+	void LayoutEntries();
+
+	// Opacity + slide from the entry's curve (render transform only, no layout; skipped when the lerp didn't move)
+	void ApplyCurve(FEntry& Entry) const;
+
+	int32 GetNumVisible() const;
+
+	// Same ToastKey, or same message when neither has a key
+	static bool IsSameToast(const FT66ToastData& A, const FT66ToastData& B);
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UT66UISurfaceRegistryDataAsset> LoadedRegistry = nullptr;
+
+	// Pooled widgets (kept here so GC sees them; FEntry holds the state)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> PoolWidgets;
+
+	TArray<FEntry> Entries;
+
+	// Waiting toasts, oldest first
+	TArray<FT66ToastData> Queue;
+
+	double LastToastTime = -1.0;
+	uint64 NextOrder = 0;
+	bool bLayoutDirty = false;
+
+	TSoftClassPtr<UUserWidget> ToastClass;
+
+	TSharedPtr<FStreamableHandle> RegistryHandle;
+	TSharedPtr<FStreamableHandle> ClassHandle;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle PostLoadMapHandle;
+};
@@ -0,0 +1,371 @@
+#include "UI/Tooltip/T66UITooltipSubsystem.h"
+
+#include "UI/Registry/T66UISurfaceRegistryDataAsset.h"
+#include "Blueprint/SlateBlueprintLibrary.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Components/Widget.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace T66UITooltip
+{
+	static FGameplayTag TooltipTag() { return FGameplayTag::RequestGameplayTag(FName(TEXT("UI.Tooltip")), /*ErrorIfNotFound=*/false); }
+}
+
+void UT66UITooltipSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
+		this,
+		&UT66UITooltipSubsystem::HandlePostLoadMapWithWorld
+	);
+
+	if (SurfaceRegistry.IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UITooltipSubsystem] No UT66UISurfaceRegistryDataAsset configured (SurfaceRegistry in DefaultGame.ini). Tooltips won't show."));
+	}
+	else
+	{
+		RegistryHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			SurfaceRegistry.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UT66UITooltipSubsystem::HandleRegistryLoaded),
+			FStreamableManager::AsyncLoadHighPriority
+		);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UITooltipSubsystem] Initialized"));
+}
+
+void UT66UITooltipSubsystem::Deinitialize()
+{
+	if (PostLoadMapHandle.IsValid())
+	{
+		FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+		PostLoadMapHandle.Reset();
+	}
+
+	if (DelayTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DelayTickerHandle);
+		DelayTickerHandle.Reset();
+	}
+
+	if (RegistryHandle.IsValid())
+	{
+		RegistryHandle->CancelHandle();
+		RegistryHandle.Reset();
+	}
+
+	if (ClassesHandle.IsValid())
+	{
+		ClassesHandle->CancelHandle();
+		ClassesHandle.Reset();
+	}
+
+	for (TPair<FGameplayTag, TObjectPtr<UUserWidget>>& Instance : Instances)
+	{
+		if (Instance.Value)
+		{
+			Instance.Value->RemoveFromParent();
+		}
+	}
+
+	Instances.Reset();
+	PendingTag = FGameplayTag();
+	PendingAnchor.Reset();
+	VisibleTag = FGameplayTag();
+	LoadedRegistry = nullptr;
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UITooltipSubsystem] Deinitialized"));
+
+	Super::Deinitialize();
+}
+
+void UT66UITooltipSubsystem::RequestTooltip(FGameplayTag TooltipTag, const FT66TooltipData& Data, UWidget* Anchor)
+{
+	if (!TooltipTag.IsValid())
+	{
+		return;
+	}
+
+	// Hover re-sent for the slot whose tooltip is already up: nothing to rebind
+	if (Anchor && VisibleTag == TooltipTag && PendingAnchor.Get() == Anchor && !DelayTickerHandle.IsValid())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const bool bWarm = VisibleTag.IsValid() || (LastHideTime >= 0.0 && Now - LastHideTime <= WarmWindow);
+
+	// ✅ Only a struct copy per hover: sweeping a grid overwrites this and restarts the delay, the widget is untouched
+	PendingTag = TooltipTag;
+	PendingData = Data;
+	PendingAnchor = Anchor;
+	PendingShowTime = Now + (bWarm ? WarmHoverDelay : HoverDelay);
+
+	if (!DelayTickerHandle.IsValid())
+	{
+		DelayTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UT66UITooltipSubsystem::HandleDelayTicker)
+		);
+	}
+}
+
+void UT66UITooltipSubsystem::HideTooltip()
+{
+	if (DelayTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DelayTickerHandle);
+		DelayTickerHandle.Reset();
+	}
+
+	PendingTag = FGameplayTag();
+	PendingAnchor.Reset();
+
+	if (VisibleTag.IsValid())
+	{
+		CollapseVisibleTooltip();
+		LastHideTime = FPlatformTime::Seconds();
+	}
+}
+
+void UT66UITooltipSubsystem::HandleRegistryLoaded()
+{
+	LoadedRegistry = SurfaceRegistry.Get();
+
+	if (!LoadedRegistry)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66UITooltipSubsystem] Failed to load surface registry: %s"), *SurfaceRegistry.ToString());
+		return;
+	}
+
+	// Stream every tooltip class up front (a handful of small widgets, needed on the first hover)
+	TArray<FSoftObjectPath> ClassPaths;
+
+	for (const TPair<FGameplayTag, TSoftClassPtr<UUserWidget>>& Entry : LoadedRegistry->SurfaceTagToWidgetClass)
+	{
+		if (Entry.Key.MatchesTag(T66UITooltip::TooltipTag()) && !Entry.Value.IsNull())
+		{
+			ClassPaths.AddUnique(Entry.Value.ToSoftObjectPath());
+		}
+	}
+
+	if (ClassPaths.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66UITooltipSubsystem] No UI.Tooltip.* surfaces registered"));
+		return;
+	}
+
+	ClassesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ClassPaths,
+		FStreamableDelegate::CreateUObject(this, &UT66UITooltipSubsystem::HandleClassesLoaded),
+		FStreamableManager::DefaultAsyncLoadPriority
+	);
+}
+
+void UT66UITooltipSubsystem::HandleClassesLoaded()
+{
+	CreateInstances();
+	AttachInstances();
+
+	UE_LOG(LogTemp, Display, TEXT("[T66UITooltipSubsystem] Tooltip pool ready: %d instances"), Instances.Num());
+}
+
+void UT66UITooltipSubsystem::HandlePostLoadMapWithWorld(UWorld* LoadedWorld)
+{
+	// Multi-client PIE: every instance gets this broadcast, only react to our own
+	if (!LoadedWorld || LoadedWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	// Travel dropped the viewport widgets and whatever was hovered
+	HideTooltip();
+	AttachInstances();
+}
+
+void UT66UITooltipSubsystem::CreateInstances()
+{
+	if (!LoadedRegistry)
+	{
+		return;
+	}
+
+	for (const TPair<FGameplayTag, TSoftClassPtr<UUserWidget>>& Entry : LoadedRegistry->SurfaceTagToWidgetClass)
+	{
+		if (!Entry.Key.MatchesTag(T66UITooltip::TooltipTag()) || Instances.Contains(Entry.Key))
+		{
+			continue;
+		}
+
+		UClass* WidgetClass = Entry.Value.Get();
+		if (!WidgetClass)
+		{
+			continue;
+		}
+
+		// Owned by the GameInstance so the pool survives travel
+		UUserWidget* Widget = CreateWidget<UUserWidget>(GetGameInstance(), WidgetClass);
+		if (!Widget)
+		{
+			continue;
+		}
+
+		if (!Widget->IsA<UT66TooltipWidgetBase>())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[T66UITooltipSubsystem] %s (%s) isn't a UT66TooltipWidgetBase: it will show, but can't bind tooltip data"),
+				*Entry.Key.ToString(), *WidgetClass->GetName());
+		}
+
+		Widget->SetVisibility(ESlateVisibility::Collapsed);
+		Instances.Add(Entry.Key, Widget);
+	}
+}
+
+void UT66UITooltipSubsystem::AttachInstances()
+{
+	const UWorld* World = GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr;
+	if (!World || !World->GetGameViewport())
+	{
+		return;
+	}
+
+	for (TPair<FGameplayTag, TObjectPtr<UUserWidget>>& Instance : Instances)
+	{
+		if (Instance.Value && !Instance.Value->IsInViewport())
+		{
+			Instance.Value->AddToViewport(TooltipZOrder);
+			Instance.Value->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	}
+}
+
+bool UT66UITooltipSubsystem::HandleDelayTicker(float DeltaTime)
+{
+	if (FPlatformTime::Seconds() < PendingShowTime)
+	{
+		return true;
+	}
+
+	// One-shot per request: returning false removes the ticker
+	DelayTickerHandle.Reset();
+	ShowPendingTooltip();
+	return false;
+}
+
+void UT66UITooltipSubsystem::ShowPendingTooltip()
+{
+	// The anchor went away during the delay (screen closed, grid rebuilt): the tooltip up from the
+	// previous hover belongs to a slot that is gone too, so take it down instead of leaving it stale
+	if (!PendingAnchor.IsExplicitlyNull() && !PendingAnchor.IsValid())
+	{
+		PendingTag = FGameplayTag();
+		PendingAnchor.Reset();
+
+		if (VisibleTag.IsValid())
+		{
+			CollapseVisibleTooltip();
+			LastHideTime = FPlatformTime::Seconds();
+		}
+
+		return;
+	}
+
+	UUserWidget* Widget = Instances.FindRef(PendingTag);
+	if (!Widget)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[T66UITooltipSubsystem] %s requested before its instance was ready (dropped)"), *PendingTag.ToString());
+		return;
+	}
+
+	if (VisibleTag.IsValid() && VisibleTag != PendingTag)
+	{
+		CollapseVisibleTooltip();
+	}
+
+	if (!Widget->IsInViewport())
+	{
+		AttachInstances();
+	}
+
+	if (UT66TooltipWidgetBase* Tooltip = Cast<UT66TooltipWidgetBase>(Widget))
+	{
+		Tooltip->NativeBindTooltipData(PendingData);
+	}
+
+	// ✅ One layout pass: measure the freshly bound content now, then place it before the first painted frame
+	Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+	Widget->ForceLayoutPrepass();
+
+	const FVector2D DesiredSize = Widget->GetDesiredSize();
+
+	Widget->SetAlignmentInViewport(FVector2D::ZeroVector);
+	Widget->SetDesiredSizeInViewport(DesiredSize);
+	Widget->SetPositionInViewport(ComputeTooltipPosition(DesiredSize), /*bRemoveDPIScale=*/false);
+
+	VisibleTag = PendingTag;
+}
+
+FVector2D UT66UITooltipSubsystem::ComputeTooltipPosition(const FVector2D& DesiredSize) const
+{
+	UWorld* World = GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr;
+	if (!World)
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	const float ViewportScale = FMath::Max(UWidgetLayoutLibrary::GetViewportScale(World), KINDA_SMALL_NUMBER);
+	const FVector2D ViewportSize = UWidgetLayoutLibrary::GetViewportSize(World) / ViewportScale;
+
+	// Preferred spot + the spot to flip to when the preferred one runs off screen
+	FVector2D Preferred;
+	FVector2D Flipped;
+
+	if (const UWidget* Anchor = PendingAnchor.Get())
+	{
+		const FGeometry& Geometry = Anchor->GetCachedGeometry();
+
+		FVector2D PixelPosition;
+		FVector2D AnchorTopLeft;
+		FVector2D AnchorBottomRight;
+		USlateBlueprintLibrary::LocalToViewport(World, Geometry, FVector2D::ZeroVector, PixelPosition, AnchorTopLeft);
+		USlateBlueprintLibrary::LocalToViewport(World, Geometry, Geometry.GetLocalSize(), PixelPosition, AnchorBottomRight);
+
+		// Right of the anchor, top-aligned (flip: left of it, bottom-aligned)
+		Preferred = FVector2D(AnchorBottomRight.X + TooltipOffset.X, AnchorTopLeft.Y);
+		Flipped = FVector2D(AnchorTopLeft.X - TooltipOffset.X - DesiredSize.X, AnchorBottomRight.Y - DesiredSize.Y);
+	}
+	else
+	{
+		const FVector2D Cursor = UWidgetLayoutLibrary::GetMousePositionOnViewport(World);
+
+		Preferred = Cursor + TooltipOffset;
+		Flipped = Cursor - TooltipOffset - DesiredSize;
+	}
+
+	FVector2D Position;
+	Position.X = (Preferred.X + DesiredSize.X > ViewportSize.X) ? Flipped.X : Preferred.X;
+	Position.Y = (Preferred.Y + DesiredSize.Y > ViewportSize.Y) ? Flipped.Y : Preferred.Y;
+
+	// Bigger than the viewport: keep the top-left corner visible
+	Position.X = FMath::Clamp(Position.X, 0.0, FMath::Max(0.0, ViewportSize.X - DesiredSize.X));
+	Position.Y = FMath::Clamp(Position.Y, 0.0, FMath::Max(0.0, ViewportSize.Y - DesiredSize.Y));
+
+	return Position;
+}
+
+void UT66UITooltipSubsystem::CollapseVisibleTooltip()
+{
+	if (UUserWidget* Widget = Instances.FindRef(VisibleTag))
+	{
+		Widget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+
+	VisibleTag = FGameplayTag();
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Containers/Ticker.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "T66UITooltipSubsystem.generated.h"
+
+class UUserWidget;
+class UWidget;
+class UT66UISurfaceRegistryDataAsset;
+struct FStreamableHandle;
+
+/**
+ * UT66UITooltipSubsystem
+ * - One pre-constructed instance per UI.Tooltip.* tag (classes from DA_UIRegistry_Surfaces, streamed in at startup)
+ * - Hover requests only copy a FT66TooltipData; the widget is bound after the hover delay, never per request
+ * - Shown tooltips are measured once (single prepass), clamped to the viewport and positioned in the same frame
+ * - Sweeping across a grid restarts the delay (warm delay once a tooltip was just visible) — no widget allocations
+ * - Instances are owned by the GameInstance and re-added to the viewport after map travel
+ */
+UCLASS(Config = Game)
+class T66_API UT66UITooltipSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Asks for a tooltip after the hover delay. Anchor = hovered widget (placed next to it), null = follow the cursor position.
+	// A new request replaces the pending/visible one.
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Tooltip", meta = (GameplayTagFilter = "UI.Tooltip"))
+	void RequestTooltip(FGameplayTag TooltipTag, const FT66TooltipData& Data, UWidget* Anchor = nullptr);
+
+	// Cancels a pending request and hides the visible tooltip
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Tooltip")
+	void HideTooltip();
+
+	// Tag of the visible tooltip (empty while none is shown)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Tooltip")
+	FGameplayTag GetVisibleTooltip() const { return VisibleTag; }
+
+	// Pooled instance for a tooltip tag (null until its class streamed in)
+	UFUNCTION(BlueprintPure, Category = "T66|UI|Tooltip", meta = (GameplayTagFilter = "UI.Tooltip"))
+	UUserWidget* GetTooltipWidget(FGameplayTag TooltipTag) const { return Instances.FindRef(TooltipTag); }
+
+protected:
+	// Surface registry, set in DefaultGame.ini (always cooked as a primary asset).
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Tooltip")
+	TSoftObjectPtr<UT66UISurfaceRegistryDataAsset> SurfaceRegistry;
+
+	// Hover time before a tooltip shows (seconds, real time)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Tooltip", meta = (ClampMin = 0))
+	float HoverDelay = 0.35f;
+
+	// Delay used while a tooltip is visible or was hidden less than WarmWindow ago (moving between slots)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Tooltip", meta = (ClampMin = 0))
+	float WarmHoverDelay = 0.05f;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Tooltip", meta = (ClampMin = 0))
+	float WarmWindow = 0.3f;
+
+	// Gap between the cursor/anchor and the tooltip (slate units)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "T66|UI|Tooltip")
+	FVector2D TooltipOffset = FVector2D(16.f, 16.f);
+
+private:
+	// Above every router layer (loading blocker is 100)
+	static constexpr int32 TooltipZOrder = 200;
+
+	void HandleRegistryLoaded();
+	void HandleClassesLoaded();
+	void HandlePostLoadMapWithWorld(UWorld* LoadedWorld);
+
+	// Creates the missing instances for loaded classes (safe to call repeatedly)
+	void CreateInstances();
+
+	// (Re)adds every instance to the viewport, collapsed
+	void AttachInstances();
+
+	// Waits for the hover delay, then shows the pending request
+	bool HandleDelayTicker(float DeltaTime);
+
+	// Binds, measures, positions and reveals the pending request in one go
+	void ShowPendingTooltip();
+
+	// Top-left viewport position (slate units) for a tooltip of DesiredSize, clamped on screen
+	FVector2D ComputeTooltipPosition(const FVector2D& DesiredSize) const;
+
+	void CollapseVisibleTooltip();
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UT66UISurfaceRegistryDataAsset> LoadedRegistry = nullptr;
+
+	// One instance per UI.Tooltip.* tag
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, TObjectPtr<UUserWidget>> Instances;
+
+	// Latest request (overwritten in place on every hover)
+	FGameplayTag PendingTag;
+	FT66TooltipData PendingData;
+	TWeakObjectPtr<UWidget> PendingAnchor;
+	double PendingShowTime = 0.0;
+
+	FGameplayTag VisibleTag;
+	double LastHideTime = -1.0;
+
+	TSharedPtr<FStreamableHandle> RegistryHandle;
+	TSharedPtr<FStreamableHandle> ClassesHandle;
+
+	FTSTicker::FDelegateHandle DelayTickerHandle;
+	FDelegateHandle PostLoadMapHandle;
+};
@@ -0,0 +1,150 @@
+#include "UI/ViewModels/T66RunHUDSubsystem.h"
+
+#include "UI/ViewModels/T66RunHUDViewModel.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "MVVMGameSubsystem.h"
+#include "Types/MVVMViewModelCollection.h"
+#include "T66RunTimerSubsystem.h"
+
+namespace T66RunHUD
+{
+	static FMVVMViewModelContext MakeContext()
+	{
+		FMVVMViewModelContext Context;
+		Context.ContextClass = UT66RunHUDViewModel::StaticClass();
+		Context.ContextName = UT66RunHUDViewModel::ContextName;
+		return Context;
+	}
+
+	static UMVVMViewModelCollectionObject* GetGlobalCollection(const UWorld* World)
+	{
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		UMVVMGameSubsystem* MVVM = GameInstance ? GameInstance->GetSubsystem<UMVVMGameSubsystem>() : nullptr;
+		return MVVM ? MVVM->GetViewModelCollection() : nullptr;
+	}
+}
+
+void UT66RunHUDSubsystem::SetPickups(int32 NewPickups)
+{
+	PendingPickups = NewPickups;
+}
+
+void UT66RunHUDSubsystem::SetHealth(float NewHealth, float NewMaxHealth)
+{
+	PendingHealth = NewHealth;
+	PendingMaxHealth = NewMaxHealth;
+}
+
+void UT66RunHUDSubsystem::SetTimerText(const FText& NewTimerText)
+{
+	PendingTimerText = NewTimerText;
+}
+
+void UT66RunHUDSubsystem::FlushPendingChanges()
+{
+	if (!ViewModel)
+	{
+		return;
+	}
+
+	// Max health first so the percent is only rebuilt against the new range.
+	if (PendingMaxHealth.IsSet())
+	{
+		ViewModel->SetMaxHealth(PendingMaxHealth.GetValue());
+	}
+
+	if (PendingHealth.IsSet())
+	{
+		ViewModel->SetHealth(PendingHealth.GetValue());
+	}
+
+	if (PendingPickups.IsSet())
+	{
+		ViewModel->SetPickups(PendingPickups.GetValue());
+	}
+
+	if (PendingTimerText.IsSet())
+	{
+		ViewModel->SetTimerText(PendingTimerText.GetValue());
+	}
+
+	PendingPickups.Reset();
+	PendingHealth.Reset();
+	PendingMaxHealth.Reset();
+	PendingTimerText.Reset();
+}
+
+bool UT66RunHUDSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UT66RunHUDSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	// The timer must exist before we bind to it on begin play.
+	Collection.InitializeDependency<UT66RunTimerSubsystem>();
+
+	Super::Initialize(Collection);
+
+	ViewModel = NewObject<UT66RunHUDViewModel>(this);
+}
+
+void UT66RunHUDSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UMVVMViewModelCollectionObject* Collection = T66RunHUD::GetGlobalCollection(&InWorld))
+	{
+		bRegisteredInCollection = Collection->AddViewModelInstance(T66RunHUD::MakeContext(), ViewModel);
+	}
+
+	if (!bRegisteredInCollection)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[UT66RunHUDSubsystem] Could not register the RunHUD viewmodel in the global collection."));
+	}
+
+	if (UT66RunTimerSubsystem* Timer = InWorld.GetSubsystem<UT66RunTimerSubsystem>())
+	{
+		BoundTimer = Timer;
+		Timer->OnTimerTextChanged.AddUObject(this, &UT66RunHUDSubsystem::SetTimerText);
+		SetTimerText(Timer->GetTimerText());
+	}
+}
+
+void UT66RunHUDSubsystem::Deinitialize()
+{
+	if (UT66RunTimerSubsystem* Timer = BoundTimer.Get())
+	{
+		Timer->OnTimerTextChanged.RemoveAll(this);
+	}
+
+	BoundTimer.Reset();
+
+	if (bRegisteredInCollection)
+	{
+		if (UMVVMViewModelCollectionObject* Collection = T66RunHUD::GetGlobalCollection(GetWorld()))
+		{
+			Collection->RemoveViewModel(T66RunHUD::MakeContext());
+		}
+
+		bRegisteredInCollection = false;
+	}
+
+	ViewModel = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UT66RunHUDSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushPendingChanges();
+}
+
+TStatId UT66RunHUDSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UT66RunHUDSubsystem, STATGROUP_Tickables);
+}
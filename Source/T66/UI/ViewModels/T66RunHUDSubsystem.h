@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "T66RunHUDSubsystem.generated.h"
+
+class UT66RunHUDViewModel;
+class UT66RunTimerSubsystem;
+
+/**
+ * UT66RunHUDSubsystem
+ * - Owns the UT66RunHUDViewModel for the current world
+ * - Registers it in the global viewmodel collection as "RunHUD"
+ * - Gameplay pushes values here; changes made during a frame are coalesced and applied once on the next tick
+ * - Mirrors the speedrun timer text into the viewmodel
+ */
+UCLASS()
+class T66_API UT66RunHUDSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintPure, Category = "T66|UI|HUD")
+	UT66RunHUDViewModel* GetViewModel() const { return ViewModel; }
+
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|HUD")
+	void SetPickups(int32 NewPickups);
+
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|HUD")
+	void SetHealth(float NewHealth, float NewMaxHealth);
+
+	void SetTimerText(const FText& NewTimerText);
+
+	// Applies pending changes right away (ex: before a screenshot or a level transition).
+	void FlushPendingChanges();
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UT66RunHUDViewModel> ViewModel = nullptr;
+
+	// Latest values pushed this frame, applied on the next tick
+	TOptional<int32> PendingPickups;
+	TOptional<float> PendingHealth;
+	TOptional<float> PendingMaxHealth;
+	TOptional<FText> PendingTimerText;
+
+	TWeakObjectPtr<UT66RunTimerSubsystem> BoundTimer;
+
+	bool bRegisteredInCollection = false;
+};
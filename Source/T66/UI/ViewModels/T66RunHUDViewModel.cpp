@@ -0,0 +1,51 @@
+#include "UI/ViewModels/T66RunHUDViewModel.h"
+
+const FName UT66RunHUDViewModel::ContextName(TEXT("RunHUD"));
+
+void UT66RunHUDViewModel::SetPickups(int32 NewPickups)
+{
+	const bool bWasVisible = Pickups > 0;
+
+	if (UE_MVVM_SET_PROPERTY_VALUE(Pickups, NewPickups) && bWasVisible != (Pickups > 0))
+	{
+		UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(GetPickupsVisibility);
+	}
+}
+
+void UT66RunHUDViewModel::SetHealth(float NewHealth)
+{
+	if (UE_MVVM_SET_PROPERTY_VALUE(Health, NewHealth))
+	{
+		UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(GetHealthPercent);
+	}
+}
+
+void UT66RunHUDViewModel::SetMaxHealth(float NewMaxHealth)
+{
+	if (UE_MVVM_SET_PROPERTY_VALUE(MaxHealth, NewMaxHealth))
+	{
+		UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(GetHealthPercent);
+	}
+}
+
+void UT66RunHUDViewModel::SetTimerText(const FText& NewTimerText)
+{
+	// FText has no equality operator, so compare the displayed text.
+	if (TimerText.EqualTo(NewTimerText))
+	{
+		return;
+	}
+
+	TimerText = NewTimerText;
+	UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(TimerText);
+}
+
+float UT66RunHUDViewModel::GetHealthPercent() const
+{
+	return MaxHealth > 0.f ? FMath::Clamp(Health / MaxHealth, 0.f, 1.f) : 0.f;
+}
+
+ESlateVisibility UT66RunHUDViewModel::GetPickupsVisibility() const
+{
+	return Pickups > 0 ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MVVMViewModelBase.h"
+#include "Components/SlateWrapperTypes.h"
+#include "T66RunHUDViewModel.generated.h"
+
+/**
+ * Viewmodel for in-run HUD values (pickups, health, run timer).
+ *
+ * Every field is FieldNotify, so widget bindings only update when a value actually changes.
+ * Gameplay doesn't set these directly: it goes through UT66RunHUDSubsystem, which coalesces
+ * all changes made during a frame into one update.
+ *
+ * Registered in the global viewmodel collection as "RunHUD" for widget blueprints to bind to.
+ */
+UCLASS(BlueprintType)
+class T66_API UT66RunHUDViewModel : public UMVVMViewModelBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Name of the viewmodel in the global viewmodel collection. */
+	static const FName ContextName;
+
+	int32 GetPickups() const { return Pickups; }
+	void SetPickups(int32 NewPickups);
+
+	float GetHealth() const { return Health; }
+	void SetHealth(float NewHealth);
+
+	float GetMaxHealth() const { return MaxHealth; }
+	void SetMaxHealth(float NewMaxHealth);
+
+	const FText& GetTimerText() const { return TimerText; }
+	void SetTimerText(const FText& NewTimerText);
+
+	/** Health as a 0..1 fraction of MaxHealth. */
+	UFUNCTION(BlueprintPure, FieldNotify, Category = "T66|UI|HUD")
+	float GetHealthPercent() const;
+
+	/** Pickup counter visibility. Stays hidden until the first pickup. */
+	UFUNCTION(BlueprintPure, FieldNotify, Category = "T66|UI|HUD")
+	ESlateVisibility GetPickupsVisibility() const;
+
+private:
+	/** Pickups collected this run. */
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Getter, Setter, Category = "T66|UI|HUD", meta = (AllowPrivateAccess = "true"))
+	int32 Pickups = 0;
+
+	/** Player's current health. */
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Getter, Setter, Category = "T66|UI|HUD", meta = (AllowPrivateAccess = "true"))
+	float Health = 0.f;
+
+	/** Player's max health. */
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Getter, Setter, Category = "T66|UI|HUD", meta = (AllowPrivateAccess = "true"))
+	float MaxHealth = 0.f;
+
+	/** Run timer text (ex: 1:23.45). */
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Getter, Setter, Category = "T66|UI|HUD", meta = (AllowPrivateAccess = "true"))
+	FText TimerText;
+};
@@ -0,0 +1,22 @@
+#include "UI/Widgets/T66HUDWidgetBase.h"
+
+#include "UI/HUD/T66HUDInvalidation.h"
+
+UT66HUDWidgetBase::UT66HUDWidgetBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UT66HUDWidgetBase::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	FT66HUDInvalidation::RegisterHUDWidget(this);
+}
+
+void UT66HUDWidgetBase::NativeDestruct()
+{
+	FT66HUDInvalidation::UnregisterHUDWidget(this);
+
+	Super::NativeDestruct();
+}
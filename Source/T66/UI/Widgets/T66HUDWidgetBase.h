@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "T66HUDWidgetBase.generated.h"
+
+/**
+ * Native backing for the in-run HUD screen (WBP_Screen_InRunHUD).
+ *
+ * Layout convention (see FT66HUDInvalidation):
+ * - Put static chrome (frames, labels, life bar backgrounds) inside an InvalidationBox
+ * - Name per-frame elements (timer, counters) Volatile_*, keep each one a small subtree
+ * - Wrap minimap / status panels in a RetainerBox for the optional low-rate mode
+ * Values come from the RunHUD viewmodel, which only notifies on real changes.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class T66_API UT66HUDWidgetBase : public UT66ScreenWidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	UT66HUDWidgetBase(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+};
@@ -1,9 +1,90 @@
 #include "UI/Widgets/T66InteractiveButtonWidgetBase.h"
 
+#include "Components/Button.h"
+#include "Components/ButtonSlot.h"
+
 UT66InteractiveButtonWidgetBase::UT66InteractiveButtonWidgetBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	bIsEnabledByDefault = true;
 	bShowIcon = false;
 	LabelText = FText::GetEmpty();
+
+	bThemed = true;
+	LabelTokens.ColorToken = TEXT("Text.Primary");
+	LabelTokens.FontSizeToken = TEXT("Text.Size.M");
+	PaddingToken = TEXT("Padding.Button");
+}
+
+void UT66InteractiveButtonWidgetBase::NativeResolveThemeTokens(UT66UIThemeSubsystem& Theme)
+{
+	LabelTokens.Resolve(Theme);
+	PaddingHandle = Theme.ResolveMarginToken(PaddingToken);
+}
+
+void UT66InteractiveButtonWidgetBase::NativeApplyTheme(const UT66UIThemeSubsystem& Theme)
+{
+	LabelTokens.Apply(Theme, Text_Label);
+
+	FMargin Padding;
+	if (Button_Root && Theme.TryGetMargin(PaddingHandle, Padding))
+	{
+		if (UButtonSlot* ContentSlot = Cast<UButtonSlot>(Button_Root->GetContentSlot()))
+		{
+			ContentSlot->SetPadding(Padding);
+		}
+	}
+}
+
+void UT66InteractiveButtonWidgetBase::SetVisibility(ESlateVisibility InVisibility)
+{
+	const ESlateVisibility PreviousVisibility = GetVisibility();
+
+	Super::SetVisibility(InVisibility);
+
+	if (PreviousVisibility != InVisibility)
+	{
+		if (UT66WidgetBase* Surface = FocusNavSurface.Get())
+		{
+			Surface->InvalidateFocusGraph();
+		}
+	}
+}
+
+FNavigationReply UT66InteractiveButtonWidgetBase::NativeOnNavigation(const FGeometry& MyGeometry, const FNavigationEvent& InNavigationEvent, const FNavigationReply& InDefaultReply)
+{
+	const FNavigationReply DefaultReply = Super::NativeOnNavigation(MyGeometry, InNavigationEvent, InDefaultReply);
+
+	if (DefaultReply.GetBoundaryRule() != EUINavigationRule::Escape)
+	{
+		return DefaultReply;
+	}
+
+	if (UT66WidgetBase* Surface = FindFocusNavSurface())
+	{
+		return Surface->ResolveFocusNavigation(this, InNavigationEvent.GetNavigationType(), DefaultReply);
+	}
+
+	return DefaultReply;
+}
+
+UT66WidgetBase* UT66InteractiveButtonWidgetBase::FindFocusNavSurface()
+{
+	if (UT66WidgetBase* Surface = FocusNavSurface.Get())
+	{
+		return Surface;
+	}
+
+	// Widget -> WidgetTree -> owning widget, up through components
+	for (UObject* Outer = GetOuter(); Outer; Outer = Outer->GetOuter())
+	{
+		UT66WidgetBase* Surface = Cast<UT66WidgetBase>(Outer);
+		if (Surface && Surface->SurfaceType != ET66UISurfaceType::Component)
+		{
+			FocusNavSurface = Surface;
+			return Surface;
+		}
+	}
+
+	return nullptr;
 }
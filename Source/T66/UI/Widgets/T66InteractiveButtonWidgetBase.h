@@ -3,12 +3,19 @@
 #include "CoreMinimal.h"
 #include "UI/Widgets/T66WidgetBase.h"
 #include "GameplayTagContainer.h"
+#include "UI/Theme/T66UIThemeSubsystem.h"
 #include "T66InteractiveButtonWidgetBase.generated.h"
 
+class UButton;
+class UTextBlock;
+
 /**
  * Base class for ALL interactive/clickable buttons in T66.
  * This guarantees the contract variables exist via inheritance
  * (no more patching variables inside the Blueprint manually).
+ *
+ * Themed by default: the label and padding are styled from theme tokens through handles,
+ * so a theme swap restyles every button without a rebuild. Clear the token names to keep a button's own style.
  */
 UCLASS(BlueprintType, Blueprintable)
 class T66_API UT66InteractiveButtonWidgetBase : public UT66ComponentWidgetBase
@@ -18,7 +25,10 @@ class T66_API UT66InteractiveButtonWidgetBase : public UT66ComponentWidgetBase
 public:
 	UT66InteractiveButtonWidgetBase(const FObjectInitializer& ObjectInitializer);
 
-	/** Focus/navigation identity for this button (used by focus system + controller nav). */
+	/**
+	 * Focus/navigation identity for this button (used by focus system + controller nav).
+	 * Buttons with a ControlID are the nodes of their surface's navigation graph (see FT66FocusNavigationGraph).
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Button", meta = (Categories = "Focus"))
 	FGameplayTag ControlID;
 
@@ -44,4 +54,43 @@ public:
 	/** Whether this button style should show an icon region (if the widget supports icons). */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Button")
 	bool bShowIcon;
+
+	/** Label color / font size theme tokens. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	FT66UIThemeTextTokens LabelTokens;
+
+	/** Margin token applied as the padding around the button's content. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	FName PaddingToken;
+
+	/** Showing/hiding a button changes its surface's navigation graph. */
+	virtual void SetVisibility(ESlateVisibility InVisibility) override;
+
+protected:
+	/** Bound by name (see the widget contract's Button_Root -> Text_Label tree). */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Button", meta = (BindWidgetOptional))
+	TObjectPtr<UButton> Button_Root;
+
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Button", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> Text_Label;
+
+	virtual void NativeResolveThemeTokens(UT66UIThemeSubsystem& Theme) override;
+	virtual void NativeApplyTheme(const UT66UIThemeSubsystem& Theme) override;
+
+	/** Navigation goes through the surface's graph (a UMG navigation rule set on the button still wins). */
+	virtual FNavigationReply NativeOnNavigation(const FGeometry& MyGeometry, const FNavigationEvent& InNavigationEvent, const FNavigationReply& InDefaultReply) override;
+
+private:
+	friend struct FT66FocusNavigationGraph;
+
+	/** Surface owning this button's tree (through components), cached once found. */
+	UT66WidgetBase* FindFocusNavSurface();
+
+	/** Surface whose graph last collected this button. */
+	TWeakObjectPtr<UT66WidgetBase> FocusNavSurface;
+
+	/** Node index in that graph (INDEX_NONE if not navigable). */
+	int32 FocusNavIndex = INDEX_NONE;
+
+	FT66UIThemeTokenHandle PaddingHandle;
 };
@@ -0,0 +1,81 @@
+#include "UI/Widgets/T66ListEntryWidgetBase.h"
+
+#include "Components/Image.h"
+#include "Components/ProgressBar.h"
+#include "Components/TextBlock.h"
+
+UT66ListEntryWidgetBase::UT66ListEntryWidgetBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bThemed = true;
+	TitleTokens.ColorToken = TEXT("Text.Primary");
+	TitleTokens.FontSizeToken = TEXT("Text.Size.M");
+	SubtitleTokens.ColorToken = TEXT("Text.Secondary");
+	SubtitleTokens.FontSizeToken = TEXT("Text.Size.S");
+	ValueTokens.ColorToken = TEXT("Text.Primary");
+	ValueTokens.FontSizeToken = TEXT("Text.Size.M");
+}
+
+void UT66ListEntryWidgetBase::NativeResolveThemeTokens(UT66UIThemeSubsystem& Theme)
+{
+	TitleTokens.Resolve(Theme);
+	SubtitleTokens.Resolve(Theme);
+	ValueTokens.Resolve(Theme);
+}
+
+void UT66ListEntryWidgetBase::NativeApplyTheme(const UT66UIThemeSubsystem& Theme)
+{
+	TitleTokens.Apply(Theme, TitleText);
+	SubtitleTokens.Apply(Theme, SubtitleText);
+	ValueTokens.Apply(Theme, ValueText);
+}
+
+void UT66ListEntryWidgetBase::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+	const UT66ListItemObject* Item = Cast<UT66ListItemObject>(ListItemObject);
+	if (!Item)
+	{
+		return;
+	}
+
+	const FT66ListItemData& Data = Item->Data;
+
+	if (TitleText)
+	{
+		TitleText->SetText(Data.Title);
+	}
+
+	if (SubtitleText)
+	{
+		SubtitleText->SetText(Data.Subtitle);
+		SubtitleText->SetVisibility(Data.Subtitle.IsEmpty() ? ESlateVisibility::Collapsed : ESlateVisibility::HitTestInvisible);
+	}
+
+	if (ValueText)
+	{
+		ValueText->SetText(Data.Value);
+	}
+
+	if (IconImage)
+	{
+		IconImage->SetVisibility(Data.Icon.IsNull() ? ESlateVisibility::Collapsed : ESlateVisibility::HitTestInvisible);
+
+		if (!Data.Icon.IsNull())
+		{
+			// Async: a fast scroll never hitches on an icon load
+			IconImage->SetBrushFromSoftTexture(Data.Icon);
+		}
+	}
+
+	if (ProgressBar)
+	{
+		ProgressBar->SetVisibility(Data.Progress < 0.f ? ESlateVisibility::Collapsed : ESlateVisibility::HitTestInvisible);
+		ProgressBar->SetPercent(FMath::Clamp(Data.Progress, 0.f, 1.f));
+	}
+
+	SetRenderOpacity(Data.bLocked ? LockedOpacity : 1.f);
+
+	OnListItemBound(Data);
+}
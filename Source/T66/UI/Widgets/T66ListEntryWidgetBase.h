@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "UI/Lists/T66ListItemObject.h"
+#include "UI/Theme/T66UIThemeSubsystem.h"
+#include "T66ListEntryWidgetBase.generated.h"
+
+class UImage;
+class UProgressBar;
+class UTextBlock;
+
+/**
+ * Native backing for list rows (WBP_Comp_ListRow) used as a list view entry.
+ *
+ * Entries are recycled by the list view: one is bound to a new UT66ListItemObject every time
+ * a row scrolls into view, so binding only writes into existing child widgets.
+ * Bind the optional widgets by name in the widget blueprint.
+ * Themed by default: the text blocks are styled from theme tokens once per construct, not per bind.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class T66_API UT66ListEntryWidgetBase : public UT66ComponentWidgetBase, public IUserObjectListEntry
+{
+	GENERATED_BODY()
+
+public:
+	UT66ListEntryWidgetBase(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> TitleText;
+
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> SubtitleText;
+
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> ValueText;
+
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List", meta = (BindWidgetOptional))
+	TObjectPtr<UImage> IconImage;
+
+	/** Collapsed when the row has no progress. */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List", meta = (BindWidgetOptional))
+	TObjectPtr<UProgressBar> ProgressBar;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	FT66UIThemeTextTokens TitleTokens;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	FT66UIThemeTextTokens SubtitleTokens;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	FT66UIThemeTextTokens ValueTokens;
+
+	/** Render opacity of locked rows. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|List")
+	float LockedOpacity = 0.5f;
+
+	/** Lets blueprints style the row (no CreateWidget here — this runs on every scroll). */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|List")
+	void OnListItemBound(const FT66ListItemData& Data);
+
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
+	virtual void NativeResolveThemeTokens(UT66UIThemeSubsystem& Theme) override;
+	virtual void NativeApplyTheme(const UT66UIThemeSubsystem& Theme) override;
+};
@@ -0,0 +1,139 @@
+#include "UI/Widgets/T66ListScreenWidgetBase.h"
+
+#include "UI/Lists/T66ListProvider.h"
+#include "UI/Router/T66UIRouterSubsystem.h"
+#include "Components/ListView.h"
+
+UT66ListScreenWidgetBase::UT66ListScreenWidgetBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UT66ListScreenWidgetBase::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	if (!ListView_Items)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[UT66ListScreenWidgetBase] %s has no ListView_Items."), *GetClass()->GetName());
+		return;
+	}
+
+	ListView_Items->OnItemClicked().AddUObject(this, &UT66ListScreenWidgetBase::HandleItemClicked);
+	ListView_Items->OnItemSelectionChanged().AddUObject(this, &UT66ListScreenWidgetBase::HandleItemSelectionChanged);
+
+	RefreshList();
+}
+
+void UT66ListScreenWidgetBase::NativeDestruct()
+{
+	if (ListView_Items)
+	{
+		ListView_Items->OnItemClicked().RemoveAll(this);
+		ListView_Items->OnItemSelectionChanged().RemoveAll(this);
+	}
+
+	Super::NativeDestruct();
+}
+
+void UT66ListScreenWidgetBase::RefreshList()
+{
+	if (!ListView_Items)
+	{
+		return;
+	}
+
+	GatheredItems.Reset();
+
+	if (Provider)
+	{
+		Provider->GatherItems(this, GatheredItems);
+	}
+
+	NumItems = GatheredItems.Num();
+
+	// Plain objects, cheap next to widgets; the pool only grows to the largest list seen
+	while (ItemPool.Num() < NumItems)
+	{
+		ItemPool.Add(NewObject<UT66ListItemObject>(this));
+	}
+
+	TArray<UObject*> Items;
+	Items.Reserve(NumItems);
+
+	const bool bHadSelection = SelectedIndex != INDEX_NONE;
+	SelectedIndex = INDEX_NONE;
+
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		UT66ListItemObject* Item = ItemPool[Index];
+		Item->Data = MoveTemp(GatheredItems[Index]);
+		Item->Index = Index;
+		Items.Add(Item);
+
+		if (bHadSelection && SelectedIndex == INDEX_NONE && Item->Data.ItemID == SelectedItemID)
+		{
+			SelectedIndex = Index;
+		}
+	}
+
+	ListView_Items->SetListItems(Items);
+
+	// Pooled items keep their identity, so visible entries must be rebound (released to the entry pool, not destroyed)
+	ListView_Items->RegenerateAllEntries();
+
+	OnListRefreshed(NumItems);
+}
+
+UT66ListItemObject* UT66ListScreenWidgetBase::GetSelectedItem() const
+{
+	return (SelectedIndex != INDEX_NONE && SelectedIndex < NumItems) ? ItemPool[SelectedIndex].Get() : nullptr;
+}
+
+bool UT66ListScreenWidgetBase::DeleteSelectedItem()
+{
+	const UT66ListItemObject* Item = GetSelectedItem();
+	if (!Item || !Provider || !Provider->DeleteItem(this, Item->Data))
+	{
+		return false;
+	}
+
+	// The row is gone: the refresh clears the selection
+	RefreshList();
+	return true;
+}
+
+void UT66ListScreenWidgetBase::HandleItemClicked(UObject* Item)
+{
+	UT66ListItemObject* ListItem = Cast<UT66ListItemObject>(Item);
+	if (!ListItem || ListItem->Data.bLocked)
+	{
+		return;
+	}
+
+	HandleItemSelectionChanged(ListItem);
+
+	// Push first so the opened surface finds the selection in its own construct
+	if (RowRouteTag.IsValid())
+	{
+		if (UT66UIRouterSubsystem* Router = GetGameInstance() ? GetGameInstance()->GetSubsystem<UT66UIRouterSubsystem>() : nullptr)
+		{
+			Router->PushSurface(RowRouteTag);
+		}
+	}
+
+	OnListItemClicked(ListItem);
+}
+
+void UT66ListScreenWidgetBase::HandleItemSelectionChanged(UObject* Item)
+{
+	// Null when the list view clears its selection: keep ours, the buttons act on the last row picked
+	const UT66ListItemObject* ListItem = Cast<UT66ListItemObject>(Item);
+	if (!ListItem || ListItem->Data.bLocked)
+	{
+		return;
+	}
+
+	SelectedIndex = ListItem->Index;
+	SelectedItemID = ListItem->Data.ItemID;
+}
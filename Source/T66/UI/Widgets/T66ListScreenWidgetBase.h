@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "UI/Lists/T66ListItemObject.h"
+#include "T66ListScreenWidgetBase.generated.h"
+
+class UListView;
+class UT66ListProvider;
+
+/**
+ * Native backing for list screens (WBP_Screen_SaveSlots, WBP_Screen_Achievements, WBP_Screen_RunDetails).
+ *
+ * Rows come from Provider as plain data and are shown in ListView_Items, a virtualized list view:
+ * only visible rows get an entry widget (recycled while scrolling), so opening a screen with 500 rows
+ * costs about the same as one with 10. Item objects are pooled across refreshes.
+ *
+ * Clicking a row selects it and opens RowRouteTag. Other surfaces (ex: the delete confirm modal) reach the
+ * selection through the router: GetSurfaceWidget -> GetSelectedItem / DeleteSelectedItem.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class T66_API UT66ListScreenWidgetBase : public UT66ScreenWidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	UT66ListScreenWidgetBase(const FObjectInitializer& ObjectInitializer);
+
+	/** Gathers the rows again (ex: after deleting a save). Only visible entries are rebound. */
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|List")
+	void RefreshList();
+
+	UFUNCTION(BlueprintPure, Category = "T66|UI|List")
+	int32 GetNumListItems() const { return NumItems; }
+
+	/** Last clicked / navigated row (null if none, or if it's gone after a refresh). */
+	UFUNCTION(BlueprintPure, Category = "T66|UI|List")
+	UT66ListItemObject* GetSelectedItem() const;
+
+	/** Deletes the selected row's data through the provider (ex: the save file), then refreshes. False if nothing was deleted. */
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|List")
+	bool DeleteSelectedItem();
+
+protected:
+	/** Virtualized list; its entry class should derive from UT66ListEntryWidgetBase (ex: WBP_Comp_ListRow). */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|List", meta = (BindWidgetOptional))
+	TObjectPtr<UListView> ListView_Items;
+
+	/** Where the rows come from. */
+	UPROPERTY(EditDefaultsOnly, Instanced, BlueprintReadOnly, Category = "T66|UI|List")
+	TObjectPtr<UT66ListProvider> Provider;
+
+	/** Surface pushed when a row is clicked (ex: UI.Screen.SavePreview). None = only OnListItemClicked. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|List", meta = (Categories = "UI"))
+	FGameplayTag RowRouteTag;
+
+	/** A row was clicked / confirmed. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|List")
+	void OnListItemClicked(UT66ListItemObject* Item);
+
+	/** The rows were (re)gathered. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|List")
+	void OnListRefreshed(int32 NumListItems);
+
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+
+private:
+	void HandleItemClicked(UObject* Item);
+	void HandleItemSelectionChanged(UObject* Item);
+
+	// Grow-only pool of item objects (a refresh rewrites them in place)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UT66ListItemObject>> ItemPool;
+
+	// Reused gather buffer
+	TArray<FT66ListItemData> GatheredItems;
+
+	int32 NumItems = 0;
+
+	// Selection by row ID so it survives a refresh that moves the row (INDEX_NONE = nothing selected)
+	int32 SelectedIndex = INDEX_NONE;
+	FName SelectedItemID;
+};
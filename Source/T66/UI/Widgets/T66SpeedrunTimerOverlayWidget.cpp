@@ -0,0 +1,96 @@
+#include "UI/Widgets/T66SpeedrunTimerOverlayWidget.h"
+
+#include "UI/HUD/T66HUDInvalidation.h"
+#include "Components/TextBlock.h"
+#include "Engine/World.h"
+#include "T66RunTimerSubsystem.h"
+
+UT66SpeedrunTimerOverlayWidget::UT66SpeedrunTimerOverlayWidget(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	AheadColor = FSlateColor(FLinearColor(0.2f, 0.9f, 0.3f));
+	BehindColor = FSlateColor(FLinearColor(0.95f, 0.25f, 0.2f));
+}
+
+void UT66SpeedrunTimerOverlayWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	// The running time changes almost every frame: keep it volatile (per t66.HUD.Invalidation) so it never invalidates the panel around it.
+	FT66HUDInvalidation::RegisterHUDWidget(this, { TimerText.Get() });
+
+	UWorld* World = GetWorld();
+	UT66RunTimerSubsystem* Timer = World ? World->GetSubsystem<UT66RunTimerSubsystem>() : nullptr;
+
+	if (!Timer)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[UT66SpeedrunTimerOverlayWidget] No run timer in this world."));
+		return;
+	}
+
+	BoundTimer = Timer;
+
+	Timer->OnTimerTextChanged.AddUObject(this, &UT66SpeedrunTimerOverlayWidget::HandleTimerTextChanged);
+	Timer->OnSplit.AddUObject(this, &UT66SpeedrunTimerOverlayWidget::HandleSplit);
+	Timer->OnStateChanged.AddUObject(this, &UT66SpeedrunTimerOverlayWidget::HandleStateChanged);
+
+	// Show the current value right away instead of waiting for the next change.
+	HandleTimerTextChanged(Timer->GetTimerText());
+}
+
+void UT66SpeedrunTimerOverlayWidget::NativeDestruct()
+{
+	if (UT66RunTimerSubsystem* Timer = BoundTimer.Get())
+	{
+		Timer->OnTimerTextChanged.RemoveAll(this);
+		Timer->OnSplit.RemoveAll(this);
+		Timer->OnStateChanged.RemoveAll(this);
+	}
+
+	BoundTimer.Reset();
+
+	FT66HUDInvalidation::UnregisterHUDWidget(this);
+
+	Super::NativeDestruct();
+}
+
+void UT66SpeedrunTimerOverlayWidget::HandleTimerTextChanged(const FText& NewText)
+{
+	if (TimerText)
+	{
+		TimerText->SetText(NewText);
+	}
+}
+
+void UT66SpeedrunTimerOverlayWidget::HandleSplit(const FT66RunSplit& Split, int64 DeltaUs)
+{
+	const int32 PrecisionMs = UT66RunTimerSubsystem::GetDisplayPrecisionMs();
+
+	if (SplitText)
+	{
+		SplitText->SetText(FText::Format(NSLOCTEXT("T66Speedrun", "SplitFormat", "{0}  {1}"),
+			FText::FromName(Split.Name), UT66RunTimerSubsystem::FormatTime(Split.RunTimeUs, PrecisionMs)));
+	}
+
+	if (SplitDeltaText)
+	{
+		// No personal best to compare against yet.
+		if (DeltaUs == 0)
+		{
+			SplitDeltaText->SetText(FText::GetEmpty());
+		}
+		else
+		{
+			const FText DeltaText = UT66RunTimerSubsystem::FormatTime(DeltaUs, PrecisionMs);
+			SplitDeltaText->SetText(DeltaUs > 0 ? FText::Format(NSLOCTEXT("T66Speedrun", "BehindFormat", "+{0}"), DeltaText) : DeltaText);
+			SplitDeltaText->SetColorAndOpacity(DeltaUs > 0 ? BehindColor : AheadColor);
+		}
+	}
+
+	OnSplitReached(Split.Name, DeltaUs / 1000000.0f);
+}
+
+void UT66SpeedrunTimerOverlayWidget::HandleStateChanged(ET66RunTimerState NewState)
+{
+	OnTimerStateChanged(NewState);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "T66RunTimerSubsystem.h"
+#include "T66SpeedrunTimerOverlayWidget.generated.h"
+
+class UTextBlock;
+
+/**
+ * Native backing for WBP_Ov_SpeedrunTimer (UI.Overlay.SpeedrunTimer).
+ *
+ * Text is pushed from UT66RunTimerSubsystem only when the displayed value changes,
+ * so the overlay never ticks and never rebuilds its text every frame.
+ * Bind the optional text blocks by name in the widget blueprint.
+ * Registered with FT66HUDInvalidation: put the panel in an InvalidationBox, TimerText is treated like a Volatile_* widget.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class T66_API UT66SpeedrunTimerOverlayWidget : public UT66OverlayWidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	UT66SpeedrunTimerOverlayWidget(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	/** Running time (ex: 1:23.45). */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Speedrun", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> TimerText;
+
+	/** Name and time of the last split reached. */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Speedrun", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> SplitText;
+
+	/** Difference between the last split and the personal best (ex: -0.42). */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Speedrun", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> SplitDeltaText;
+
+	/** Color for splits ahead of the personal best. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Speedrun")
+	FSlateColor AheadColor;
+
+	/** Color for splits behind the personal best. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Speedrun")
+	FSlateColor BehindColor;
+
+	/** Lets blueprints react to splits (animations, sounds). DeltaSeconds is zero without a personal best. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|Speedrun")
+	void OnSplitReached(FName SplitName, float DeltaSeconds);
+
+	/** Lets blueprints react to the timer starting, pausing or finishing. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|Speedrun")
+	void OnTimerStateChanged(ET66RunTimerState NewState);
+
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+
+private:
+	void HandleTimerTextChanged(const FText& NewText);
+	void HandleSplit(const FT66RunSplit& Split, int64 DeltaUs);
+	void HandleStateChanged(ET66RunTimerState NewState);
+
+	TWeakObjectPtr<UT66RunTimerSubsystem> BoundTimer;
+};
@@ -0,0 +1,30 @@
+#include "UI/Widgets/T66ToastWidgetBase.h"
+
+#include "Components/TextBlock.h"
+
+UT66ToastWidgetBase::UT66ToastWidgetBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UT66ToastWidgetBase::NativeBindToast(const FT66ToastData& Data)
+{
+	if (MessageText)
+	{
+		MessageText->SetText(Data.Message);
+	}
+
+	if (DetailText)
+	{
+		DetailText->SetText(Data.Detail);
+		DetailText->SetVisibility(Data.Detail.IsEmpty() ? ESlateVisibility::Collapsed : ESlateVisibility::HitTestInvisible);
+	}
+
+	if (CountText)
+	{
+		CountText->SetText(FText::Format(NSLOCTEXT("T66Toast", "CountFormat", "x{0}"), FText::AsNumber(Data.Count)));
+		CountText->SetVisibility(Data.Count > 1 ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+	}
+
+	OnToastBound(Data);
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/Widgets/T66WidgetBase.h"
+#include "T66ToastWidgetBase.generated.h"
+
+class UTextBlock;
+class UTexture2D;
+
+/**
+ * One toast message. Toasts with the same key are coalesced (Count goes up instead of a new entry showing).
+ */
+USTRUCT(BlueprintType)
+struct T66_API FT66ToastData
+{
+	GENERATED_BODY()
+
+	/** Coalescing key (ex: the item ID for loot). None = the message text is the key. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Toast")
+	FName ToastKey;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Toast")
+	FText Message;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Toast")
+	FText Detail;
+
+	/** Soft so queueing a toast never loads anything. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Toast")
+	TSoftObjectPtr<UTexture2D> Icon;
+
+	/** Seconds on screen (0 = the subsystem default). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Toast", meta = (ClampMin = 0))
+	float Duration = 0.f;
+
+	/** How many toasts were coalesced into this one (set by UT66UIToastSubsystem). */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Toast")
+	int32 Count = 1;
+};
+
+/**
+ * Native backing for WBP_Ov_Toast (UI.Overlay.Toast).
+ *
+ * Instances are pooled by UT66UIToastSubsystem and rebound for every toast they show.
+ * Enter/exit motion is applied from native code (render opacity + translation), so the
+ * blueprint shouldn't play its own UMG animations. Bind the optional text blocks by name.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class T66_API UT66ToastWidgetBase : public UT66OverlayWidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	UT66ToastWidgetBase(const FObjectInitializer& ObjectInitializer);
+
+	/** Called by UT66UIToastSubsystem when the toast is shown and again whenever its Count changes. */
+	virtual void NativeBindToast(const FT66ToastData& Data);
+
+protected:
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Toast", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> MessageText;
+
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Toast", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> DetailText;
+
+	/** Coalesced count (ex: x3). Collapsed while Count is 1. */
+	UPROPERTY(BlueprintReadOnly, Category = "T66|UI|Toast", meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> CountText;
+
+	/** Lets blueprints set the icon or anything else (no CreateWidget here — this runs for every toast). */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|Toast")
+	void OnToastBound(const FT66ToastData& Data);
+};
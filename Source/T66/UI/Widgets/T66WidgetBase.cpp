@@ -1,11 +1,151 @@
 #include "UI/Widgets/T66WidgetBase.h"
 
+#include "UI/Theme/T66UIThemeSubsystem.h"
+#include "UI/T66UISurfaceStats.h"
+#include "Engine/GameInstance.h"
+#include "HAL/PlatformTime.h"
+
+namespace T66WidgetBase
+{
+	static UT66UIThemeSubsystem* GetThemeSubsystem(const UUserWidget* Widget)
+	{
+		const UGameInstance* GameInstance = Widget ? Widget->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UT66UIThemeSubsystem>() : nullptr;
+	}
+}
+
 UT66WidgetBase::UT66WidgetBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	SurfaceType = ET66UISurfaceType::Unknown;
 }
 
+TSharedRef<SWidget> UT66WidgetBase::RebuildWidget()
+{
+	// Components are measured as part of the surface that contains them
+	if (!FT66UISurfaceStats::IsEnabled() || SurfaceType == ET66UISurfaceType::Component)
+	{
+		return Super::RebuildWidget();
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const TSharedRef<SWidget> Content = Super::RebuildWidget();
+	RebuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	return FT66UISurfaceStats::WrapSurfaceContent(SurfaceID, Content);
+}
+
+void UT66WidgetBase::NativeConstruct()
+{
+	const bool bMeasure = FT66UISurfaceStats::IsEnabled() && SurfaceType != ET66UISurfaceType::Component && SurfaceID.IsValid();
+	const double StartTime = bMeasure ? FPlatformTime::Seconds() : 0.0;
+
+	Super::NativeConstruct();
+
+	if (bThemed)
+	{
+		if (UT66UIThemeSubsystem* Theme = T66WidgetBase::GetThemeSubsystem(this))
+		{
+			Theme->RegisterThemedWidget(this);
+
+			NativeResolveThemeTokens(*Theme);
+			NativeApplyTheme(*Theme);
+		}
+	}
+
+	// Controls and their layout are new
+	FocusGraph.Invalidate();
+
+	if (bMeasure && !bRegisteredSurfaceStats)
+	{
+		FT66UISurfaceStats::RegisterSurface(this, RebuildMs + (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		bRegisteredSurfaceStats = true;
+	}
+
+	RebuildMs = 0.0;
+}
+
+void UT66WidgetBase::NativeDestruct()
+{
+	if (bRegisteredSurfaceStats)
+	{
+		FT66UISurfaceStats::UnregisterSurface(this);
+		bRegisteredSurfaceStats = false;
+	}
+
+	if (bThemed)
+	{
+		if (UT66UIThemeSubsystem* Theme = T66WidgetBase::GetThemeSubsystem(this))
+		{
+			Theme->UnregisterThemedWidget(this);
+		}
+	}
+
+	Super::NativeDestruct();
+}
+
+void UT66WidgetBase::NativeThemeChanged()
+{
+	if (const UT66UIThemeSubsystem* Theme = T66WidgetBase::GetThemeSubsystem(this))
+	{
+		NativeApplyTheme(*Theme);
+	}
+
+	OnThemeChanged();
+
+	// Margins/sizes can change layout, colors only paint — a layout invalidation covers both without a rebuild
+	Invalidate(EInvalidateWidgetReason::Layout);
+	FocusGraph.Invalidate();
+}
+
+void UT66WidgetBase::InvalidateFocusGraph()
+{
+	FocusGraph.Invalidate();
+}
+
+bool UT66WidgetBase::FocusDefaultControl()
+{
+	if (!DefaultFocusID.IsValid())
+	{
+		return false;
+	}
+
+	RebuildFocusGraphIfNeeded();
+
+	UWidget* Target = FocusGraph.FindFocusTarget(DefaultFocusID);
+	if (!Target)
+	{
+		return false;
+	}
+
+	Target->SetFocus();
+	return true;
+}
+
+FNavigationReply UT66WidgetBase::ResolveFocusNavigation(const UT66InteractiveButtonWidgetBase* Control, EUINavigation Direction, const FNavigationReply& DefaultReply)
+{
+	RebuildFocusGraphIfNeeded();
+
+	bool bStop = false;
+	if (const UWidget* Target = FocusGraph.FindNavigationTarget(Control, Direction, bStop))
+	{
+		if (const TSharedPtr<SWidget> TargetWidget = Target->GetCachedWidget())
+		{
+			return FNavigationReply::Explicit(TargetWidget);
+		}
+	}
+
+	return bStop ? FNavigationReply::Stop() : DefaultReply;
+}
+
+void UT66WidgetBase::RebuildFocusGraphIfNeeded()
+{
+	if (SurfaceType != ET66UISurfaceType::Component && FocusGraph.NeedsRebuild(*this))
+	{
+		FocusGraph.Build(*this, FocusEdges);
+	}
+}
+
 UT66ScreenWidgetBase::UT66ScreenWidgetBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -29,3 +169,14 @@ UT66ComponentWidgetBase::UT66ComponentWidgetBase(const FObjectInitializer& Objec
 {
 	SurfaceType = ET66UISurfaceType::Component;
 }
+
+UT66TooltipWidgetBase::UT66TooltipWidgetBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SurfaceType = ET66UISurfaceType::Tooltip;
+}
+
+void UT66TooltipWidgetBase::NativeBindTooltipData(const FT66TooltipData& Data)
+{
+	OnBindTooltipData(Data);
+}
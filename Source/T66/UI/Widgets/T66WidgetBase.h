@@ -3,8 +3,13 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "GameplayTagContainer.h"
+#include "UI/Focus/T66FocusNavigationGraph.h"
 #include "T66WidgetBase.generated.h"
 
+class UTexture2D;
+class UT66InteractiveButtonWidgetBase;
+class UT66UIThemeSubsystem;
+
 UENUM(BlueprintType)
 enum class ET66UISurfaceType : uint8
 {
@@ -13,6 +18,38 @@ enum class ET66UISurfaceType : uint8
 	Modal       UMETA(DisplayName = "Modal"),
 	Overlay     UMETA(DisplayName = "Overlay"),
 	Component   UMETA(DisplayName = "Component"),
+	Tooltip     UMETA(DisplayName = "Tooltip"),
+};
+
+/**
+ * Lightweight tooltip content (copied per hover, never a widget).
+ * UT66UITooltipSubsystem binds it to a pooled tooltip instance once the hover delay elapsed.
+ */
+USTRUCT(BlueprintType)
+struct T66_API FT66TooltipData
+{
+	GENERATED_BODY()
+
+	/** Data ID of what is hovered (ex: an item/idol/enemy row name). Lets the tooltip pull extra data itself. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Tooltip")
+	FName ContentID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Tooltip")
+	FText Title;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Tooltip")
+	FText Subtitle;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Tooltip")
+	FText Body;
+
+	/** Soft so building the struct on hover never loads anything. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Tooltip")
+	TSoftObjectPtr<UTexture2D> Icon;
+
+	/** Free numeric slot (stack count, level, cost...). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "T66|UI|Tooltip")
+	int32 Value = 0;
 };
 
 /**
@@ -47,9 +84,78 @@ public:
 	/**
 	 * Optional focus target the UI system can use when the widget is shown.
 	 * Example tags live under Focus.* (Focus.Primary, Focus.List, Focus.Cancel, etc).
+	 * Matched against the ControlID of the surface's buttons (see FocusDefaultControl).
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI", meta = (Categories = "Focus"))
 	FGameplayTag DefaultFocusID;
+
+	/**
+	 * Navigation edges that override the ones computed from the layout (ex: wrap a column, skip a button,
+	 * stop at the edge of a panel). Only used by Screen/Modal/Overlay surfaces.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Focus")
+	TArray<FT66FocusNavEdge> FocusEdges;
+
+	/**
+	 * Optional UI.Input.* context applied while this surface is open (ex: UI.Input.Modal).
+	 * The router pushes it on open / pops it on close through UT66UIInputContextSubsystem (ref-counted).
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI", meta = (Categories = "UI.Input"))
+	FGameplayTag InputContextTag;
+
+	/**
+	 * If true, this widget reads theme tokens (through UT66UIThemeSubsystem handles) and is told when the theme changes.
+	 * A theme swap calls OnThemeChanged and invalidates the widget — it is never reconstructed.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "T66|UI|Theme")
+	bool bThemed = false;
+
+	/** Called by UT66UIThemeSubsystem after the theme tables were rewritten. */
+	virtual void NativeThemeChanged();
+
+	/**
+	 * Marks the focus navigation graph for a rebuild on the next navigation.
+	 * Call it after adding/removing/moving buttons at runtime (show/hide of a button is already tracked).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Focus")
+	void InvalidateFocusGraph();
+
+	/** Focuses the button whose ControlID is DefaultFocusID. Returns false if there is none (or it's disabled/hidden). */
+	UFUNCTION(BlueprintCallable, Category = "T66|UI|Focus")
+	bool FocusDefaultControl();
+
+	/**
+	 * Called by a button of this surface when Slate asks where focus goes next.
+	 * Rebuilds the graph if it was invalidated, then reads the edge. DefaultReply when the graph has no edge.
+	 */
+	FNavigationReply ResolveFocusNavigation(const UT66InteractiveButtonWidgetBase* Control, EUINavigation Direction, const FNavigationReply& DefaultReply);
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+
+	/** Re-read theme handles here (cheap array reads) and apply them to child widgets. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|Theme")
+	void OnThemeChanged();
+
+	/** Native themed widgets resolve their token names to handles here (once per construct, bThemed only). */
+	virtual void NativeResolveThemeTokens(UT66UIThemeSubsystem& Theme) {}
+
+	/** Native themed widgets read their handles and style their children here (on construct and on every theme change). */
+	virtual void NativeApplyTheme(const UT66UIThemeSubsystem& Theme) {}
+
+private:
+	/** Slate rebuild time of the last RebuildWidget, added to the construct time reported to FT66UISurfaceStats. */
+	double RebuildMs = 0.0;
+
+	/** True while this surface is counted by FT66UISurfaceStats. */
+	bool bRegisteredSurfaceStats = false;
+
+	/** ControlID navigation table, built lazily after layout (Screen/Modal/Overlay surfaces only). */
+	FT66FocusNavigationGraph FocusGraph;
+
+	void RebuildFocusGraphIfNeeded();
 };
 
 /** Base class for any full-screen UI "Screen". */
@@ -82,6 +188,27 @@ public:
 	UT66OverlayWidgetBase(const FObjectInitializer& ObjectInitializer);
 };
 
+/**
+ * Base class for UI "Tooltips" (WBP_Tooltip_*).
+ * Never created on hover: UT66UITooltipSubsystem keeps one instance per UI.Tooltip.* tag and rebinds it.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class T66_API UT66TooltipWidgetBase : public UT66WidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	UT66TooltipWidgetBase(const FObjectInitializer& ObjectInitializer);
+
+	/** Called by UT66UITooltipSubsystem right before the tooltip is measured and shown. */
+	virtual void NativeBindTooltipData(const FT66TooltipData& Data);
+
+protected:
+	/** Write the data into existing child widgets only (no CreateWidget here — this runs on every hover). */
+	UFUNCTION(BlueprintImplementableEvent, Category = "T66|UI|Tooltip")
+	void OnBindTooltipData(const FT66TooltipData& Data);
+};
+
 /** Base class for reusable UI components (buttons, panels, etc). */
 UCLASS(BlueprintType, Blueprintable)
 class T66_API UT66ComponentWidgetBase : public UT66WidgetBase
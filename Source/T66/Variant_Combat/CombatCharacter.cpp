@@ -15,6 +15,8 @@
 #include "TimerManager.h"
 #include "Engine/LocalPlayer.h"
 #include "CombatPlayerController.h"
+#include "T66InputLatency.h"
+#include "UI/ViewModels/T66RunHUDSubsystem.h"
 
 ACombatCharacter::ACombatCharacter()
 {
@@ -133,6 +135,9 @@ void ACombatCharacter::DoComboAttackStart()
 		return;
 	}
 
+	// start measuring the input latency up to the first attack frame
+	FT66InputLatency::BeginAction(ET66InputLatencyAction::ComboAttack, this, ComboAttackMontage);
+
 	// perform a combo attack
 	ComboAttack();
 }
@@ -155,6 +160,9 @@ void ACombatCharacter::DoChargedAttackStart()
 		return;
 	}
 
+	// start measuring the input latency up to the first attack frame
+	FT66InputLatency::BeginAction(ET66InputLatencyAction::ChargedAttack, this, ChargedAttackMontage);
+
 	ChargedAttack();
 }
 
@@ -177,6 +185,22 @@ void ACombatCharacter::ResetHP()
 
 	// update the life bar
 	LifeBarWidget->SetLifePercentage(1.0f);
+
+	// update the HUD
+	UpdateRunHUD();
+}
+
+void ACombatCharacter::UpdateRunHUD()
+{
+	if (!IsPlayerControlled())
+	{
+		return;
+	}
+
+	if (UT66RunHUDSubsystem* HUD = GetWorld()->GetSubsystem<UT66RunHUDSubsystem>())
+	{
+		HUD->SetHealth(FMath::Max(CurrentHP, 0.0f), MaxHP);
+	}
 }
 
 void ACombatCharacter::ComboAttack()
@@ -447,6 +471,9 @@ float ACombatCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dama
 	// reduce the current HP
 	CurrentHP -= Damage;
 
+	// update the HUD
+	UpdateRunHUD();
+
 	// have we run out of HP?
 	if (CurrentHP <= 0.0f)
 	{
@@ -543,5 +570,8 @@ void ACombatCharacter::NotifyControllerChanged()
 	{
 		PC->SetRespawnTransform(GetActorTransform());
 	}
+
+	// show our HP on the HUD now that we may be player controlled
+	UpdateRunHUD();
 }
 
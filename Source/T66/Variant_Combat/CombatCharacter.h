@@ -245,6 +245,9 @@ protected:
 	/** Resets the character's current HP to maximum */
 	void ResetHP();
 
+	/** Pushes the current HP to the run HUD if this is the player character */
+	void UpdateRunHUD();
+
 	/** Performs a combo attack */
 	void ComboAttack();
 
@@ -11,6 +11,8 @@
 #include "Engine/World.h"
 #include "Blueprint/UserWidget.h"
 #include "T66.h"
+#include "T66InputLatency.h"
+#include "InputKeyEventArgs.h"
 #include "Widgets/Input/SVirtualJoystick.h"
 
 void ACombatPlayerController::BeginPlay()
@@ -64,6 +66,17 @@ void ACombatPlayerController::SetupInputComponent()
 	}
 }
 
+bool ACombatPlayerController::InputKey(const FInputKeyEventArgs& Params)
+{
+	// timestamp key presses so we can measure how long they take to become visible actions
+	if (Params.Event == IE_Pressed)
+	{
+		FT66InputLatency::NotifyInputArrived(this);
+	}
+
+	return Super::InputKey(Params);
+}
+
 void ACombatPlayerController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
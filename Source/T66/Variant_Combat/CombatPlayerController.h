@@ -7,6 +7,7 @@
 #include "CombatPlayerController.generated.h"
 
 class UInputMappingContext;
+struct FInputKeyEventArgs;
 class ACombatCharacter;
 
 /**
@@ -56,6 +57,9 @@ protected:
 	/** Initialize input bindings */
 	virtual void SetupInputComponent() override;
 
+	/** Timestamps key presses for the input latency instrumentation */
+	virtual bool InputKey(const FInputKeyEventArgs& Params) override;
+
 	/** Pawn initialization */
 	virtual void OnPossess(APawn* InPawn) override;
 
@@ -5,6 +5,8 @@
 #include "Components/BoxComponent.h"
 #include "GameFramework/Character.h"
 #include "CombatActivatable.h"
+#include "Engine/World.h"
+#include "T66RunTimerSubsystem.h"
 
 ACombatActivationVolume::ACombatActivationVolume()
 {
@@ -43,6 +45,12 @@ void ACombatActivationVolume::OnOverlap(UPrimitiveComponent* OverlappedComponent
 					Activatable->ActivateInteraction(PlayerCharacter);
 				}
 			}
+
+			// record the speedrun split. The timer ignores splits that were already reached
+			if (UT66RunTimerSubsystem* RunTimer = GetWorld()->GetSubsystem<UT66RunTimerSubsystem>())
+			{
+				RunTimer->ReachSplit(SplitName, bFinalSplit);
+			}
 		}
 	}
 
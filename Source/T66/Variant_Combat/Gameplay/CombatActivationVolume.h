@@ -26,6 +26,14 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Activation Volume")
 	TArray<AActor*> ActorsToActivate;
 
+	/** Speedrun split reached when the player enters this volume. None disables the split */
+	UPROPERTY(EditAnywhere, Category="Speedrun")
+	FName SplitName;
+
+	/** If true, reaching this split finishes the run */
+	UPROPERTY(EditAnywhere, Category="Speedrun")
+	bool bFinalSplit = false;
+
 public:	
 	
 	/** Constructor */
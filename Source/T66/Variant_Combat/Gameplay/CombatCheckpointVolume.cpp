@@ -4,6 +4,8 @@
 #include "CombatCheckpointVolume.h"
 #include "CombatCharacter.h"
 #include "CombatPlayerController.h"
+#include "Engine/World.h"
+#include "T66RunTimerSubsystem.h"
 
 ACombatCheckpointVolume::ACombatCheckpointVolume()
 {
@@ -41,6 +43,12 @@ void ACombatCheckpointVolume::OnOverlap(UPrimitiveComponent* OverlappedComponent
 
 			// update the player's respawn checkpoint
 			PC->SetRespawnTransform(PlayerCharacter->GetActorTransform());
+
+			// record the speedrun split
+			if (UT66RunTimerSubsystem* RunTimer = GetWorld()->GetSubsystem<UT66RunTimerSubsystem>())
+			{
+				RunTimer->ReachSplit(SplitName, bFinalSplit);
+			}
 		}
 
 	}
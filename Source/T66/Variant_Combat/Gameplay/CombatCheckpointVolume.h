@@ -26,6 +26,14 @@ protected:
 	/** Set to true after use to avoid accidentally resetting the checkpoint */
 	bool bCheckpointUsed = false;
 
+	/** Speedrun split reached when the player first enters this checkpoint. None disables the split */
+	UPROPERTY(EditAnywhere, Category="Speedrun")
+	FName SplitName;
+
+	/** If true, reaching this split finishes the run */
+	UPROPERTY(EditAnywhere, Category="Speedrun")
+	bool bFinalSplit = false;
+
 	/** Handles overlaps with the box volume */
 	UFUNCTION()
 	void OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
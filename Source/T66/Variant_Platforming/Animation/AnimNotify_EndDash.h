@@ -7,7 +7,8 @@
 #include "AnimNotify_EndDash.generated.h"
 
 /**
- *  AnimNotify to finish the dash animation and restore player control
+ *  AnimNotify that marks where the dash ends in the dash montage.
+ *  It has no runtime behavior: the character reads its time to set the movement component's simulated dash duration
  */
 UCLASS()
 class UAnimNotify_EndDash : public UAnimNotify
@@ -16,9 +17,6 @@ class UAnimNotify_EndDash : public UAnimNotify
 	
 public:
 
-	/** Perform the Anim Notify */
-	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
-
 	/** Get the notify name */
 	virtual FString GetNotifyName_Implementation() const override;
 };
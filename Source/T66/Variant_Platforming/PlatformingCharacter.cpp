@@ -11,22 +11,18 @@
 #include "Camera/CameraComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "EnhancedInputComponent.h"
-#include "TimerManager.h"
 #include "Engine/LocalPlayer.h"
-
-APlatformingCharacter::APlatformingCharacter()
+#include "Animation/AnimMontage.h"
+#include "AnimNotify_EndDash.h"
+#include "T66CharacterMovementComponent.h"
+#include "T66GhostRecorderComponent.h"
+#include "T66InputLatency.h"
+
+APlatformingCharacter::APlatformingCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UT66CharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
  	PrimaryActorTick.bCanEverTick = true;
 
-	// initialize the flags
-	bHasWallJumped = false;
-	bHasDoubleJumped = false;
-	bHasDashed = false;
-	bIsDashing = false;
-
-	// bind the dash montage ended delegate
-	OnDashMontageEnded.BindUObject(this, &APlatformingCharacter::DashMontageEnded);
-
 	// enable press and hold jump
 	JumpMaxHoldTime = 0.4f;
 
@@ -61,6 +57,17 @@ APlatformingCharacter::APlatformingCharacter()
 	GetCharacterMovement()->NavAgentProps.AgentRadius = 42.0;
 	GetCharacterMovement()->NavAgentProps.AgentHeight = 192.0;
 
+	// configure the advanced movement abilities
+	UT66CharacterMovementComponent* T66Movement = GetT66CharacterMovement();
+
+	T66Movement->WallJumpTraceDistance = 50.0f;
+	T66Movement->WallJumpTraceRadius = 25.0f;
+	T66Movement->bWallJumpRequiresInput = false;
+	T66Movement->WallJumpHorizontalImpulse = 800.0f;
+	T66Movement->WallJumpVerticalImpulse = 900.0f;
+	T66Movement->DelayBetweenWallJumps = 0.1f;
+	T66Movement->MaxCoyoteTime = 0.16f;
+
 	// create the camera boom
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
 	CameraBoom->SetupAttachment(RootComponent);
@@ -76,6 +83,9 @@ APlatformingCharacter::APlatformingCharacter()
 	FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	FollowCamera->bUsePawnControlRotation = false;
+
+	// create the ghost recorder
+	GhostRecorder = CreateDefaultSubobject<UT66GhostRecorderComponent>(TEXT("GhostRecorder"));
 }
 
 void APlatformingCharacter::Move(const FInputActionValue& Value)
@@ -103,99 +113,8 @@ void APlatformingCharacter::Dash()
 
 void APlatformingCharacter::MultiJump()
 {
-	// ignore jumps while dashing
-	if(bIsDashing)
-		return;
-
-	// are we already in the air?
-	if (GetCharacterMovement()->IsFalling())
-	{
-
-		// have we already wall jumped?
-		if (!bHasWallJumped)
-		{
-			// run a sphere sweep to check if we're in front of a wall
-			FHitResult OutHit;
-
-			const FVector TraceStart = GetActorLocation();
-			const FVector TraceEnd = TraceStart + (GetActorForwardVector() * WallJumpTraceDistance);
-			const FCollisionShape TraceShape = FCollisionShape::MakeSphere(WallJumpTraceRadius);
-
-			FCollisionQueryParams QueryParams;
-			QueryParams.AddIgnoredActor(this);
-
-			if (GetWorld()->SweepSingleByChannel(OutHit, TraceStart, TraceEnd, FQuat(), ECollisionChannel::ECC_Visibility, TraceShape, QueryParams))
-			{
-				// rotate the character to face away from the wall, so we're correctly oriented for the next wall jump
-				FRotator WallOrientation = OutHit.ImpactNormal.ToOrientationRotator();
-				WallOrientation.Pitch = 0.0f;
-				WallOrientation.Roll = 0.0f;
-
-				SetActorRotation(WallOrientation);
-
-				// apply a launch impulse to the character to perform the actual wall jump
-				const FVector WallJumpImpulse = (OutHit.ImpactNormal * WallJumpBounceImpulse) + (FVector::UpVector * WallJumpVerticalImpulse);
-
-				LaunchCharacter(WallJumpImpulse, true, true);
-
-				// enable the jump trail
-				SetJumpTrailState(true);
-
-				// raise the wall jump flag to prevent an immediate second wall jump
-				bHasWallJumped = true;
-
-				GetWorld()->GetTimerManager().SetTimer(WallJumpTimer, this, &APlatformingCharacter::ResetWallJump, DelayBetweenWallJumps, false);
-			}
-			// no wall jump, try a double jump next
-			else
-			{
-				// are we still within coyote time frames?
-				if (GetWorld()->GetTimeSeconds() - LastFallTime < MaxCoyoteTime)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("Coyote Jump"));
-
-					// use the built-in CMC functionality to do the jump
-					Jump();
-
-					// enable the jump trail
-					SetJumpTrailState(true);
-
-				// no coyote time jump
-				} else {
-
-					// only double jump once while we're in the air
-					if (!bHasDoubleJumped)
-					{
-						bHasDoubleJumped = true;
-
-						// use the built-in CMC functionality to do the double jump
-						Jump();
-
-						// enable the jump trail
-						SetJumpTrailState(true);
-					}
-
-				}
-
-				
-			}
-		}
-
-	}
-	else
-	{
-		// we're grounded so just do a regular jump
-		Jump();
-
-		// activate the jump trail
-		SetJumpTrailState(true);
-	}
-}
-
-void APlatformingCharacter::ResetWallJump()
-{
-	// reset the wall jump input lock
-	bHasWallJumped = false;
+	// let the movement component resolve ground, coyote, double and wall jumps
+	GetT66CharacterMovement()->HandleJumpPressed();
 }
 
 void APlatformingCharacter::DoMove(float Right, float Forward)
@@ -203,7 +122,7 @@ void APlatformingCharacter::DoMove(float Right, float Forward)
 	if (GetController() != nullptr)
 	{
 		// momentarily disable movement inputs if we've just wall jumped
-		if (!bHasWallJumped)
+		if (!HasWallJumped())
 		{
 			// find out which way is forward
 			const FRotator Rotation = GetController()->GetControlRotation();
@@ -234,38 +153,19 @@ void APlatformingCharacter::DoLook(float Yaw, float Pitch)
 
 void APlatformingCharacter::DoDash()
 {
-	// ignore the input if we've already dashed and have yet to reset
-	if (bHasDashed)
+	// ask the movement component for a dash. This is ignored if we've already dashed and have yet to reset
+	if (!GetT66CharacterMovement()->RequestDash())
 		return;
 
-	// raise the dash flags
-	bIsDashing = true;
-	bHasDashed = true;
-
-	// disable gravity while dashing
-	GetCharacterMovement()->GravityScale = 0.0f;
-
-	// reset the character velocity so we don't carry momentum into the dash
-	GetCharacterMovement()->Velocity = FVector::ZeroVector;
-
-	// enable the jump trails
-	SetJumpTrailState(true);
-
-	// play the dash montage
-	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
-	{
-		const float MontageLength = AnimInstance->Montage_Play(DashMontage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
-
-		// has the montage played successfully?
-		if (MontageLength > 0.0f)
-		{
-			AnimInstance->Montage_SetEndDelegate(OnDashMontageEnded, DashMontage);
-		}
-	}
+	// start measuring the input latency up to the first dash frame
+	FT66InputLatency::BeginAction(ET66InputLatencyAction::Dash, this, DashMontage);
 }
 
 void APlatformingCharacter::DoJumpStart()
 {
+	// start measuring the input latency up to the applied jump
+	FT66InputLatency::BeginAction(ET66InputLatencyAction::Jump, this);
+
 	// handle special jump cases
 	MultiJump();
 }
@@ -276,47 +176,91 @@ void APlatformingCharacter::DoJumpEnd()
 	StopJumping();
 }
 
-void APlatformingCharacter::DashMontageEnded(UAnimMontage* Montage, bool bInterrupted)
+void APlatformingCharacter::OnMovementAbility(ET66MovementAbility Ability, const FVector& Direction)
 {
-	// end the dash
-	EndDash();
+	switch (Ability)
+	{
+	case ET66MovementAbility::GroundJump:
+	case ET66MovementAbility::CoyoteJump:
+	case ET66MovementAbility::DoubleJump:
+	case ET66MovementAbility::WallJump:
+
+		// enable the jump trail
+		SetJumpTrailState(true);
+		break;
+
+	case ET66MovementAbility::DashStart:
+
+		// enable the jump trails
+		SetJumpTrailState(true);
+
+		// play the dash montage. It's cosmetic only, the movement component ends the dash on its own simulated timer
+		if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+		{
+			AnimInstance->Montage_Play(DashMontage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
+		}
+		break;
+
+	default:
+		break;
+	}
 }
 
-void APlatformingCharacter::EndDash()
+float APlatformingCharacter::GetDashMontageDuration() const
 {
-	// restore gravity
-	GetCharacterMovement()->GravityScale = 2.5f;
+	if (!DashMontage)
+	{
+		return 0.0f;
+	}
 
-	// reset the dashing flag
-	bIsDashing = false;
+	// the dash ends on the first End Dash notify, or when the montage finishes
+	float Duration = DashMontage->GetPlayLength();
 
-	// are we grounded after the dash?
-	if (GetCharacterMovement()->IsMovingOnGround())
+	for (const FAnimNotifyEvent& NotifyEvent : DashMontage->Notifies)
 	{
-		// reset the dash usage flag, since we won't receive a landed event
-		bHasDashed = false;
-
-		// deactivate the jump trails
-		SetJumpTrailState(false);
+		if (Cast<UAnimNotify_EndDash>(NotifyEvent.Notify))
+		{
+			Duration = FMath::Min(Duration, NotifyEvent.GetTriggerTime());
+		}
 	}
+
+	return Duration;
 }
 
 bool APlatformingCharacter::HasDoubleJumped() const
 {
-	return bHasDoubleJumped;
+	return GetT66CharacterMovement()->HasDoubleJumped();
 }
 
 bool APlatformingCharacter::HasWallJumped() const
 {
-	return bHasWallJumped;
+	return GetT66CharacterMovement()->HasWallJumped();
 }
 
-void APlatformingCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+bool APlatformingCharacter::IsWallSliding() const
 {
-	Super::EndPlay(EndPlayReason);
+	return GetT66CharacterMovement()->IsWallSliding();
+}
 
-	// clear the wall jump reset timer
-	GetWorld()->GetTimerManager().ClearTimer(WallJumpTimer);
+UT66CharacterMovementComponent* APlatformingCharacter::GetT66CharacterMovement() const
+{
+	return CastChecked<UT66CharacterMovementComponent>(GetCharacterMovement());
+}
+
+void APlatformingCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	UT66CharacterMovementComponent* T66Movement = GetT66CharacterMovement();
+
+	// simulate the dash for as long as the montage says it lasts
+	if (DashMontage)
+	{
+		T66Movement->DashDuration = GetDashMontageDuration();
+	}
+
+	// listen for movement abilities to drive the cosmetic state
+	T66Movement->OnMovementAbility.AddUObject(this, &APlatformingCharacter::OnMovementAbility);
 }
 
 void APlatformingCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -345,23 +289,36 @@ void APlatformingCharacter::Landed(const FHitResult& Hit)
 {
 	Super::Landed(Hit);
 
-	// reset the double jump and dash flags
-	bHasDoubleJumped = false;
-	bHasDashed = false;
-
-	// deactivate the jump trail
+	// deactivate the jump trail. The movement component resets the double jump and dash flags
 	SetJumpTrailState(false);
 }
 
-void APlatformingCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode /*= 0*/)
+#if WITH_EDITORONLY_DATA
+void APlatformingCharacter::PostLoad()
 {
-	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
+	Super::PostLoad();
 
-	// are we falling?
-	if (GetCharacterMovement()->MovementMode == EMovementMode::MOVE_Falling)
+	UT66CharacterMovementComponent* T66Movement = GetT66CharacterMovement();
+
+	if (!T66Movement)
 	{
-		// save the game time when we started falling, so we can check it later for coyote time jumps
-		LastFallTime = GetWorld()->GetTimeSeconds();
+		return;
 	}
-}
 
+	// only forward values a Blueprint changed from the old defaults, so overrides made on the component are kept
+	auto Forward = [](float DeprecatedValue, float OldDefault, float& NewValue)
+	{
+		if (!FMath::IsNearlyEqual(DeprecatedValue, OldDefault))
+		{
+			NewValue = DeprecatedValue;
+		}
+	};
+
+	Forward(WallJumpTraceDistance_DEPRECATED, 50.0f, T66Movement->WallJumpTraceDistance);
+	Forward(WallJumpTraceRadius_DEPRECATED, 25.0f, T66Movement->WallJumpTraceRadius);
+	Forward(WallJumpBounceImpulse_DEPRECATED, 800.0f, T66Movement->WallJumpHorizontalImpulse);
+	Forward(WallJumpVerticalImpulse_DEPRECATED, 900.0f, T66Movement->WallJumpVerticalImpulse);
+	Forward(DelayBetweenWallJumps_DEPRECATED, 0.1f, T66Movement->DelayBetweenWallJumps);
+	Forward(MaxCoyoteTime_DEPRECATED, 0.16f, T66Movement->MaxCoyoteTime);
+}
+#endif
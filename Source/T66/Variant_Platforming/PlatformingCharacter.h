@@ -13,6 +13,9 @@ class UCameraComponent;
 class UInputAction;
 struct FInputActionValue;
 class UAnimMontage;
+class UT66CharacterMovementComponent;
+class UT66GhostRecorderComponent;
+enum class ET66MovementAbility : uint8;
 
 /**
  *  An enhanced Third Person Character with the following functionality:
@@ -21,6 +24,7 @@ class UAnimMontage;
  *  - Double Jump
  *  - Wall Jump
  *  - Dash
+ *  Advanced movement is simulated by UT66CharacterMovementComponent so it can be client predicted
  */
 UCLASS(abstract)
 class APlatformingCharacter : public ACharacter
@@ -34,6 +38,10 @@ class APlatformingCharacter : public ACharacter
 	/** Follow camera */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
 	UCameraComponent* FollowCamera;
+
+	/** Records the run for ghost playback */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UT66GhostRecorderComponent* GhostRecorder;
 	
 protected:
 
@@ -60,7 +68,7 @@ protected:
 public:
 
 	/** Constructor */
-	APlatformingCharacter();
+	APlatformingCharacter(const FObjectInitializer& ObjectInitializer);
 
 protected:
 
@@ -76,9 +84,6 @@ protected:
 	/** Called for jump pressed to check for advanced multi-jump conditions */
 	void MultiJump();
 
-	/** Resets the wall jump input lock */
-	void ResetWallJump();
-
 public:
 
 	/** Handles move inputs from either controls or UI interfaces */
@@ -103,18 +108,16 @@ public:
 
 protected:
 
-	/** Called from a delegate when the dash montage ends */
-	void DashMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+	/** Called from the movement component when a movement ability is performed */
+	void OnMovementAbility(ET66MovementAbility Ability, const FVector& Direction);
+
+	/** Returns the dash duration as authored in the dash montage */
+	float GetDashMontageDuration() const;
 
 	/** Passes control to Blueprint to enable or disable jump trails */
 	UFUNCTION(BlueprintImplementableEvent, Category="Platforming")
 	void SetJumpTrailState(bool bEnabled);
 
-public:
-
-	/** Ends the dash state */
-	void EndDash();
-
 public:
 
 	/** Returns true if the character has just double jumped */
@@ -125,64 +128,52 @@ public:
 	UFUNCTION(BlueprintPure, Category="Platforming")
 	bool HasWallJumped() const;
 
-public:	
-	
-	/** EndPlay cleanup */
-	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	/** Returns true if the character is sliding down a wall */
+	UFUNCTION(BlueprintPure, Category="Platforming")
+	bool IsWallSliding() const;
+
+public:
+
+	/** Binds to the movement component ability events */
+	virtual void PostInitializeComponents() override;
 
 	/** Sets up input action bindings */
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
-	/** Handle landings to reset dash and advanced jump state */
+	/** Handle landings to disable the jump trails */
 	virtual void Landed(const FHitResult& Hit) override;
 
-	/** Handle movement mode changes to keep track of coyote time jumps */
-	virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode = 0) override;
+#if WITH_EDITORONLY_DATA
+	/** Forwards Blueprint overrides of the deprecated wall jump and coyote settings to the movement component */
+	virtual void PostLoad() override;
+#endif
 
 protected:
 
-	/** movement state flag bits, packed into a uint8 for memory efficiency */
-	uint8 bHasWallJumped : 1;
-	uint8 bHasDoubleJumped : 1;
-	uint8 bHasDashed : 1;
-	uint8 bIsDashing : 1;
-
-	/** timer for wall jump input reset */
-	FTimerHandle WallJumpTimer;
-
-	/** Dash montage ended delegate */
-	FOnMontageEnded OnDashMontageEnded;
-
-	/** Distance to trace ahead of the character to look for walls to jump from */
-	UPROPERTY(EditAnywhere, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm"))
-	float WallJumpTraceDistance = 50.0f;
-
-	/** Radius of the wall jump sphere trace check */
-	UPROPERTY(EditAnywhere, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 100, Units = "cm"))
-	float WallJumpTraceRadius = 25.0f;
+	/** AnimMontage to use for the Dash action */
+	UPROPERTY(EditAnywhere, Category="Dash")
+	UAnimMontage* DashMontage;
 
-	/** Impulse to apply away from the wall when wall jumping */
-	UPROPERTY(EditAnywhere, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 10000, Units = "cm/s"))
-	float WallJumpBounceImpulse = 800.0f;
+#if WITH_EDITORONLY_DATA
+	/** Wall jump and coyote settings that moved to UT66CharacterMovementComponent. Loaded only to forward old overrides */
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float WallJumpTraceDistance_DEPRECATED = 50.0f;
 
-	/** Vertical impulse to apply when wall jumping */
-	UPROPERTY(EditAnywhere, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 10000, Units = "cm/s"))
-	float WallJumpVerticalImpulse = 900.0f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float WallJumpTraceRadius_DEPRECATED = 25.0f;
 
-	/** Time to ignore jump inputs after a wall jump */
-	UPROPERTY(EditAnywhere, Category="Wall Jump", meta = (ClampMin = 0, ClampMax = 5, Units = "s"))
-	float DelayBetweenWallJumps = 0.1f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent (WallJumpHorizontalImpulse)."))
+	float WallJumpBounceImpulse_DEPRECATED = 800.0f;
 
-	/** AnimMontage to use for the Dash action */
-	UPROPERTY(EditAnywhere, Category="Dash")
-	UAnimMontage* DashMontage;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float WallJumpVerticalImpulse_DEPRECATED = 900.0f;
 
-	/** Last recorded time when this character started falling */
-	float LastFallTime = 0.0f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float DelayBetweenWallJumps_DEPRECATED = 0.1f;
 
-	/** Max amount of time that can pass since we started falling when we allow a regular jump */
-	UPROPERTY(EditAnywhere, Category="Coyote Time", meta = (ClampMin = 0, ClampMax = 5, Units = "s"))
-	float MaxCoyoteTime = 0.16f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float MaxCoyoteTime_DEPRECATED = 0.16f;
+#endif
 
 public:
 	/** Returns CameraBoom subobject **/
@@ -191,4 +182,10 @@ public:
 	/** Returns FollowCamera subobject **/
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 
+	/** Returns GhostRecorder subobject **/
+	FORCEINLINE class UT66GhostRecorderComponent* GetGhostRecorder() const { return GhostRecorder; }
+
+	/** Returns the platforming movement component **/
+	UT66CharacterMovementComponent* GetT66CharacterMovement() const;
+
 };
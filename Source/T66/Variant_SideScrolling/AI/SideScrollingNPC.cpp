@@ -5,6 +5,7 @@
 #include "Engine/World.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
+#include "SideScrollingInteractionSubsystem.h"
 
 ASideScrollingNPC::ASideScrollingNPC()
 {
@@ -13,10 +14,27 @@ ASideScrollingNPC::ASideScrollingNPC()
 	GetCharacterMovement()->MaxWalkSpeed = 150.0f;
 }
 
+void ASideScrollingNPC::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// register as an interactable
+	if (USideScrollingInteractionSubsystem* Interactions = USideScrollingInteractionSubsystem::Get(this))
+	{
+		Interactions->RegisterInteractable(this);
+	}
+}
+
 void ASideScrollingNPC::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	// unregister as an interactable
+	if (USideScrollingInteractionSubsystem* Interactions = USideScrollingInteractionSubsystem::Get(this))
+	{
+		Interactions->UnregisterInteractable(this);
+	}
+
 	// clear the deactivation timer
 	GetWorld()->GetTimerManager().ClearTimer(DeactivationTimer);
 }
@@ -47,6 +47,9 @@ public:
 
 public:
 
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
 	/** Cleanup */
 	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
@@ -57,6 +60,9 @@ public:
 	/** Performs an interaction triggered by another actor */
 	virtual void Interaction(AActor* Interactor) override;
 
+	/** Returns true if the NPC can be interacted with right now */
+	virtual bool CanInteract(const AActor* Interactor) const override { return !bDeactivated; }
+
 //	~end IInteractable interface
 
 	/** Reactivates the NPC */
@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingCameraHeightField.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+#include "T66.h"
+
+ASideScrollingCameraHeightField::ASideScrollingCameraHeightField()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	// create the bake area. It's only a bounds helper, so it has no collision
+	RootComponent = Box = CreateDefaultSubobject<UBoxComponent>(TEXT("Box"));
+	check(Box);
+
+	Box->SetBoxExtent(FVector(5000.0f, 200.0f, 2000.0f));
+	Box->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Box->SetGenerateOverlapEvents(false);
+	Box->SetHiddenInGame(true);
+}
+
+bool ASideScrollingCameraHeightField::FindGroundBelow(const FVector& Location, float MaxDistance, bool& bOutHasGround) const
+{
+	if (!HasBakedData())
+	{
+		return false;
+	}
+
+	// find the column
+	const int32 Column = FMath::FloorToInt32((Location.X - OriginX) / CellSize);
+
+	if (Column < 0 || Column >= ColumnOffsets.Num() - 1)
+	{
+		return false;
+	}
+
+	// surfaces above or below the baked range weren't sampled
+	if (Location.Z < MinZ || Location.Z > MaxZ)
+	{
+		return false;
+	}
+
+	// surfaces are sorted top to bottom, so the first one at or below the location is the ground
+	for (int32 Index = ColumnOffsets[Column]; Index < ColumnOffsets[Column + 1]; ++Index)
+	{
+		if (Heights[Index] <= Location.Z)
+		{
+			bOutHasGround = Location.Z - Heights[Index] <= MaxDistance;
+			return true;
+		}
+	}
+
+	// nothing baked below us. The ground may be past the bottom of the box or a layer cap, so let the caller trace
+	return false;
+}
+
+#if WITH_EDITOR
+
+void ASideScrollingCameraHeightField::Bake()
+{
+	UWorld* World = GetWorld();
+
+	if (!World)
+	{
+		return;
+	}
+
+	Modify();
+
+	const FBox Bounds = Box->Bounds.GetBox();
+	const int32 NumColumns = FMath::Max(1, FMath::CeilToInt32(Bounds.GetSize().X / CellSize));
+
+	OriginX = Bounds.Min.X;
+	MinZ = Bounds.Min.Z;
+	MaxZ = Bounds.Max.Z;
+	ColumnOffsets.Reset(NumColumns + 1);
+	Heights.Reset();
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SideScrollingCameraHeightFieldBake), true);
+
+	for (int32 Column = 0; Column < NumColumns; ++Column)
+	{
+		ColumnOffsets.Add(Heights.Num());
+
+		// trace down the middle of the column, restarting below every surface we find
+		const float X = OriginX + (Column + 0.5f) * CellSize;
+		FVector TraceStart(X, Bounds.GetCenter().Y, Bounds.Max.Z);
+		const FVector TraceEnd(X, Bounds.GetCenter().Y, Bounds.Min.Z);
+
+		int32 NumLayers = 0;
+
+		while (NumLayers < MaxLayersPerColumn && TraceStart.Z > TraceEnd.Z)
+		{
+			FHitResult OutHit;
+
+			if (!World->LineTraceSingleByChannel(OutHit, TraceStart, TraceEnd, TraceChannel, QueryParams))
+			{
+				break;
+			}
+
+			// only keep walkable surfaces
+			if (OutHit.ImpactNormal.Z >= MinWalkableNormalZ)
+			{
+				Heights.Add(OutHit.ImpactPoint.Z);
+				++NumLayers;
+			}
+
+			// keep looking below this surface
+			TraceStart.Z = OutHit.ImpactPoint.Z - 1.0f;
+		}
+	}
+
+	ColumnOffsets.Add(Heights.Num());
+
+	UE_LOG(LogT66, Display, TEXT("Baked camera height field %s: %d columns, %d surfaces"), *GetActorNameOrLabel(), NumColumns, Heights.Num());
+}
+
+void ASideScrollingCameraHeightField::ClearBakedData()
+{
+	Modify();
+
+	OriginX = 0.0f;
+	MinZ = 0.0f;
+	MaxZ = 0.0f;
+	ColumnOffsets.Reset();
+	Heights.Reset();
+}
+
+#endif
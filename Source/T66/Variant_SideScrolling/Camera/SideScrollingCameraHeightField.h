@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SideScrollingCameraHeightField.generated.h"
+
+class UBoxComponent;
+
+/**
+ *  Baked walkable ground heights along the side scrolling X axis.
+ *  The box defines the baked area. Each column along X stores every walkable surface height in it, top to bottom,
+ *  packed into a single array with per-column offsets so the whole field is a couple of flat arrays saved with the level.
+ *  The side scrolling camera reads this instead of tracing down every frame.
+ *  Bake in the editor with the Bake button, or Tools > T66 Tools: Bake Side Scrolling Camera Height Fields.
+ */
+UCLASS()
+class T66_API ASideScrollingCameraHeightField : public AActor
+{
+	GENERATED_BODY()
+
+	/** Baked area */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UBoxComponent* Box;
+
+protected:
+
+	/** Width of each column along X */
+	UPROPERTY(EditAnywhere, Category="Height Field", meta = (ClampMin = 1, ClampMax = 1000, Units = "cm"))
+	float CellSize = 25.0f;
+
+	/** Collision channel used to find the ground while baking */
+	UPROPERTY(EditAnywhere, Category="Height Field")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	/** Min surface normal Z to be considered walkable ground */
+	UPROPERTY(EditAnywhere, Category="Height Field", meta = (ClampMin = 0, ClampMax = 1))
+	float MinWalkableNormalZ = 0.25f;
+
+	/** Max surfaces stored per column */
+	UPROPERTY(EditAnywhere, Category="Height Field", meta = (ClampMin = 1, ClampMax = 32))
+	int32 MaxLayersPerColumn = 8;
+
+	/** World X of the first column */
+	UPROPERTY(VisibleAnywhere, Category="Height Field|Baked Data")
+	float OriginX = 0.0f;
+
+	/** Bottom of the baked Z range. Surfaces below it weren't sampled */
+	UPROPERTY(VisibleAnywhere, Category="Height Field|Baked Data")
+	float MinZ = 0.0f;
+
+	/** Top of the baked Z range */
+	UPROPERTY(VisibleAnywhere, Category="Height Field|Baked Data")
+	float MaxZ = 0.0f;
+
+	/** Offset of each column's first height in Heights. Has one more entry than there are columns */
+	UPROPERTY(VisibleAnywhere, Category="Height Field|Baked Data")
+	TArray<int32> ColumnOffsets;
+
+	/** Walkable surface heights for all columns, each column sorted top to bottom */
+	UPROPERTY(VisibleAnywhere, Category="Height Field|Baked Data")
+	TArray<float> Heights;
+
+public:
+
+	/** Constructor */
+	ASideScrollingCameraHeightField();
+
+	/**
+	 *  Looks for baked ground below a location.
+	 *  Returns false if the location is outside the baked columns or Z range, or there's no baked surface below it,
+	 *  so the caller should fall back to a trace.
+	 *  Otherwise sets bOutHasGround if the surface below the location is within MaxDistance.
+	 */
+	bool FindGroundBelow(const FVector& Location, float MaxDistance, bool& bOutHasGround) const;
+
+	/** Returns true if the field has baked data. Data baked before the Z range was stored needs a rebake */
+	bool HasBakedData() const { return ColumnOffsets.Num() > 1 && MaxZ > MinZ; }
+
+#if WITH_EDITOR
+
+	/** Samples the level's walkable ground inside the box */
+	UFUNCTION(CallInEditor, Category="Height Field")
+	void Bake();
+
+	/** Clears the baked data */
+	UFUNCTION(CallInEditor, Category="Height Field")
+	void ClearBakedData();
+
+#endif
+};
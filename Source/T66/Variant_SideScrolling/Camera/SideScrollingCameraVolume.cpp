@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingCameraVolume.h"
+#include "Components/BoxComponent.h"
+
+ASideScrollingCameraVolume::ASideScrollingCameraVolume()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	// create the covered area. The camera reads it by X, so it has no collision
+	RootComponent = Box = CreateDefaultSubobject<UBoxComponent>(TEXT("Box"));
+	check(Box);
+
+	Box->SetBoxExtent(FVector(2000.0f, 200.0f, 1000.0f));
+	Box->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Box->SetGenerateOverlapEvents(false);
+	Box->SetHiddenInGame(true);
+}
+
+FSideScrollingCameraSegment ASideScrollingCameraVolume::MakeSegment() const
+{
+	const FBox Bounds = Box->Bounds.GetBox();
+
+	FSideScrollingCameraSegment Segment = Settings;
+	Segment.MinX = Bounds.Min.X;
+	Segment.MaxX = Bounds.Max.X;
+	Segment.BoundsMinX = bClampToVolume ? Bounds.Min.X : CameraXMinBounds;
+	Segment.BoundsMaxX = bClampToVolume ? Bounds.Max.X : CameraXMaxBounds;
+	Segment.RailZ = Bounds.GetCenter().Z;
+
+	return Segment;
+}
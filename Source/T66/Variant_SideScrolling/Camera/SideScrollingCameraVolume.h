@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SideScrollingCameraVolume.generated.h"
+
+class UBoxComponent;
+
+/**
+ *  Camera settings for a stretch of a side scrolling level
+ */
+USTRUCT(BlueprintType)
+struct FSideScrollingCameraSegment
+{
+	GENERATED_BODY()
+
+	/** Start of the segment along X */
+	float MinX = 0.0f;
+
+	/** End of the segment along X */
+	float MaxX = 0.0f;
+
+	/** Camera X is clamped to these bounds while in this segment */
+	float BoundsMinX = 0.0f;
+
+	/** Camera X is clamped to these bounds while in this segment */
+	float BoundsMaxX = 0.0f;
+
+	/** How close we want to stay to the view target */
+	UPROPERTY(EditAnywhere, Category="Camera Segment", meta=(ClampMin=0, ClampMax=10000, Units="cm"))
+	float Zoom = 1000.0f;
+
+	/** Extra height added to the camera on top of its normal framing */
+	UPROPERTY(EditAnywhere, Category="Camera Segment", meta=(ClampMin=-10000, ClampMax=10000, Units="cm"))
+	float ZOffset = 0.0f;
+
+	/** How fast the camera blends towards its target location */
+	UPROPERTY(EditAnywhere, Category="Camera Segment", meta=(ClampMin=0, ClampMax=100))
+	float InterpSpeed = 2.0f;
+
+	/** How fast the camera blends towards a new height */
+	UPROPERTY(EditAnywhere, Category="Camera Segment", meta=(ClampMin=0, ClampMax=100))
+	float HeightInterpSpeed = 2.0f;
+
+	/** If true, the camera stays at RailZ instead of following the target's height */
+	UPROPERTY(EditAnywhere, Category="Camera Segment")
+	bool bRail = false;
+
+	/** Camera height while on a rail */
+	float RailZ = 0.0f;
+};
+
+/**
+ *  Camera rail and bounds volume for the side scrolling camera.
+ *  The box's X extents define the stretch of the level it covers.
+ *  Volumes are compiled by the camera manager at BeginPlay into segments sorted along X.
+ *  Where volumes overlap, the one that starts further along X takes over.
+ */
+UCLASS()
+class T66_API ASideScrollingCameraVolume : public AActor
+{
+	GENERATED_BODY()
+
+	/** Covered area */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UBoxComponent* Box;
+
+protected:
+
+	/** Camera settings for this stretch of the level */
+	UPROPERTY(EditAnywhere, Category="Camera Volume", meta = (ShowOnlyInnerProperties))
+	FSideScrollingCameraSegment Settings;
+
+	/** If true, the camera X is clamped to the box. Otherwise it's clamped to the bounds below */
+	UPROPERTY(EditAnywhere, Category="Camera Volume")
+	bool bClampToVolume = true;
+
+	/** Minimum camera scrolling bounds in world space */
+	UPROPERTY(EditAnywhere, Category="Camera Volume", meta=(EditCondition="!bClampToVolume", ClampMin=-100000, ClampMax=100000, Units="cm"))
+	float CameraXMinBounds = -400.0f;
+
+	/** Maximum camera scrolling bounds in world space */
+	UPROPERTY(EditAnywhere, Category="Camera Volume", meta=(EditCondition="!bClampToVolume", ClampMin=-100000, ClampMax=100000, Units="cm"))
+	float CameraXMaxBounds = 10000.0f;
+
+public:
+
+	/** Constructor */
+	ASideScrollingCameraVolume();
+
+	/** Builds the camera segment covered by this volume. Rails are locked to the box's center height */
+	FSideScrollingCameraSegment MakeSegment() const;
+};
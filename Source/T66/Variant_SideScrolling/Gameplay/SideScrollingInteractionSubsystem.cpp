@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingInteractionSubsystem.h"
+#include "SideScrollingInteractable.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+void USideScrollingInteractionSubsystem::RegisterInteractable(AActor* Interactable)
+{
+	Interactables.AddUnique(Interactable);
+}
+
+void USideScrollingInteractionSubsystem::UnregisterInteractable(AActor* Interactable)
+{
+	Interactables.RemoveSwap(Interactable);
+}
+
+void USideScrollingInteractionSubsystem::FindCandidates(AActor* Interactor, float Radius, TArray<AActor*>& OutCandidates) const
+{
+	OutCandidates.Reset();
+
+	const FVector InteractorLocation = Interactor->GetActorLocation();
+	const float InteractorFacing = FMath::Sign(Interactor->GetActorForwardVector().X);
+
+	// score each candidate by distance, counting the ones behind us as further away
+	TArray<TPair<float, AActor*>, TInlineAllocator<8>> Scored;
+
+	for (const TWeakObjectPtr<AActor>& Entry : Interactables)
+	{
+		AActor* Candidate = Entry.Get();
+
+		if (!Candidate || Candidate == Interactor)
+		{
+			continue;
+		}
+
+		const ISideScrollingInteractable* Interactable = Cast<ISideScrollingInteractable>(Candidate);
+
+		if (!Interactable || !Interactable->CanInteract(Interactor))
+		{
+			continue;
+		}
+
+		// movement is constrained to the X/Z plane, so ignore Y
+		const FVector Offset = Candidate->GetActorLocation() - InteractorLocation;
+		const float DistanceSquared = FMath::Square(Offset.X) + FMath::Square(Offset.Z);
+
+		if (DistanceSquared > FMath::Square(Radius))
+		{
+			continue;
+		}
+
+		const bool bInFront = Offset.X * InteractorFacing >= 0.0f;
+		Scored.Emplace(bInFront ? DistanceSquared : DistanceSquared * 4.0f, Candidate);
+	}
+
+	Scored.Sort([](const TPair<float, AActor*>& A, const TPair<float, AActor*>& B) { return A.Key < B.Key; });
+
+	for (const TPair<float, AActor*>& Entry : Scored)
+	{
+		OutCandidates.Add(Entry.Value);
+	}
+}
+
+USideScrollingInteractionSubsystem* USideScrollingInteractionSubsystem::Get(const AActor* Actor)
+{
+	const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USideScrollingInteractionSubsystem>() : nullptr;
+}
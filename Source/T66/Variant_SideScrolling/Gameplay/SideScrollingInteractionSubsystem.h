@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SideScrollingInteractionSubsystem.generated.h"
+
+/**
+ *  Registry of the ISideScrollingInteractable actors in the world.
+ *  Interactables register themselves on BeginPlay, so characters can find interaction candidates
+ *  with a distance check over a short list instead of a physics query.
+ */
+UCLASS()
+class USideScrollingInteractionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/** Registered interactables */
+	TArray<TWeakObjectPtr<AActor>> Interactables;
+
+public:
+
+	/** Adds an interactable actor to the registry */
+	void RegisterInteractable(AActor* Interactable);
+
+	/** Removes an interactable actor from the registry */
+	void UnregisterInteractable(AActor* Interactable);
+
+	/**
+	 *  Finds the interactables within reach of an interactor, on the X/Z plane.
+	 *  Candidates are sorted best first: closest, preferring the ones in front of the interactor.
+	 */
+	void FindCandidates(AActor* Interactor, float Radius, TArray<AActor*>& OutCandidates) const;
+
+	/** Returns the subsystem for the actor's world, if any */
+	static USideScrollingInteractionSubsystem* Get(const AActor* Actor);
+};
@@ -3,6 +3,8 @@
 
 #include "SideScrollingMovingPlatform.h"
 #include "Components/SceneComponent.h"
+#include "SideScrollingPlatformMoverComponent.h"
+#include "SideScrollingInteractionSubsystem.h"
 
 ASideScrollingMovingPlatform::ASideScrollingMovingPlatform()
 {
@@ -10,10 +12,47 @@ ASideScrollingMovingPlatform::ASideScrollingMovingPlatform()
 
 	// create the root comp
 	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	// create the native mover
+	Mover = CreateDefaultSubobject<USideScrollingPlatformMoverComponent>(TEXT("Mover"));
+}
+
+void ASideScrollingMovingPlatform::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// register as an interactable
+	if (USideScrollingInteractionSubsystem* Interactions = USideScrollingInteractionSubsystem::Get(this))
+	{
+		Interactions->RegisterInteractable(this);
+	}
+}
+
+void ASideScrollingMovingPlatform::EndPlay(EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	// unregister as an interactable
+	if (USideScrollingInteractionSubsystem* Interactions = USideScrollingInteractionSubsystem::Get(this))
+	{
+		Interactions->UnregisterInteractable(this);
+	}
+}
+
+bool ASideScrollingMovingPlatform::CanInteract(const AActor* Interactor) const
+{
+	return Mover->HasPath() ? Mover->CanBeTriggered() : !bMoving;
 }
 
 void ASideScrollingMovingPlatform::Interaction(AActor* Interactor)
 {
+	// let the native mover handle it if it has a path
+	if (Mover->HasPath())
+	{
+		Mover->Interaction();
+		return;
+	}
+
 	// ignore interactions if we're already moving
 	if (bMoving)
 	{
@@ -7,14 +7,21 @@
 #include "SideScrollingInteractable.h"
 #include "SideScrollingMovingPlatform.generated.h"
 
+class USideScrollingPlatformMoverComponent;
+
 /**
  *  Simple moving platform that can be triggered through interactions by other actors.
- *  The actual movement is performed by Blueprint code through latent execution nodes.
+ *  If the mover component has waypoints, it moves the platform natively.
+ *  Otherwise the actual movement is performed by Blueprint code through latent execution nodes.
  */
 UCLASS(abstract)
 class ASideScrollingMovingPlatform : public AActor, public ISideScrollingInteractable
 {
 	GENERATED_BODY()
+
+	/** Native platform movement */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	USideScrollingPlatformMoverComponent* Mover;
 	
 public:	
 	
@@ -45,14 +52,26 @@ public:
 	/** Performs an interaction triggered by another actor */
 	virtual void Interaction(AActor* Interactor) override;
 
+	/** Returns true if the platform can be set in motion right now */
+	virtual bool CanInteract(const AActor* Interactor) const override;
+
 // ~end IInteractable interface
 
 	/** Resets the interaction state. Must be called from BP code to reset the platform */
 	UFUNCTION(BlueprintCallable, Category="Moving Platform")
 	virtual void ResetInteraction();
 
+	/** Returns the native platform mover */
+	USideScrollingPlatformMoverComponent* GetMover() const { return Mover; }
+
 protected:
 
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
+	/** Gameplay cleanup */
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
 	/** Allows Blueprint code to do the actual platform movement */
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="Moving Platform", meta = (DisplayName="Move to Target"))
 	void BP_MoveToTarget();
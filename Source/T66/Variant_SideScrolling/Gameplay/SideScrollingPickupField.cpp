@@ -0,0 +1,209 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingPickupField.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+#include "Algo/Sort.h"
+#include "Algo/BinarySearch.h"
+#include "SideScrollingGameMode.h"
+
+ASideScrollingPickupField::ASideScrollingPickupField()
+{
+	// check for pickups once the players have moved
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickGroup = TG_PostPhysics;
+
+	// clients hide the pickups the server collected
+	bReplicates = true;
+
+	// create the pickup instances. Collection is done by distance, so they have no collision
+	RootComponent = Pickups = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("Pickups"));
+	check(Pickups);
+
+	Pickups->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Pickups->SetGenerateOverlapEvents(false);
+	Pickups->SetCanEverAffectNavigation(false);
+}
+
+void ASideScrollingPickupField::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// every machine tracks which instances are hidden
+	HiddenInstances.Init(false, Pickups->GetInstanceCount());
+
+	// only the server counts pickups
+	if (!HasAuthority())
+	{
+		// hide anything collected before we joined, without replaying its effects
+		HideCollectedPickups(false);
+		return;
+	}
+
+	// sort the pickups along X
+	SortedPickups.Reset(Pickups->GetInstanceCount());
+
+	for (int32 InstanceIndex = 0; InstanceIndex < Pickups->GetInstanceCount(); ++InstanceIndex)
+	{
+		FTransform InstanceTransform;
+		Pickups->GetInstanceTransform(InstanceIndex, InstanceTransform, true);
+
+		FPickupEntry& Entry = SortedPickups.AddDefaulted_GetRef();
+		Entry.X = InstanceTransform.GetLocation().X;
+		Entry.Z = InstanceTransform.GetLocation().Z;
+		Entry.InstanceIndex = InstanceIndex;
+	}
+
+	Algo::SortBy(SortedPickups, &FPickupEntry::X);
+
+	NumRemaining = SortedPickups.Num();
+
+	SetActorTickEnabled(NumRemaining > 0);
+}
+
+void ASideScrollingPickupField::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	TArray<FVector> CollectedLocations;
+	int32 NumCollected = 0;
+
+	// check every player pawn against the pickups
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PC = It->Get())
+		{
+			if (const APawn* Pawn = PC->GetPawn())
+			{
+				NumCollected += CollectPickups(Pawn, CollectedLocations);
+			}
+		}
+	}
+
+	if (NumCollected == 0)
+	{
+		return;
+	}
+
+	// hidden instances were updated without a render state update, so do it once for the whole batch
+	Pickups->MarkRenderStateDirty();
+
+	// tell the game mode to process the pickups
+	if (ASideScrollingGameMode* GM = Cast<ASideScrollingGameMode>(GetWorld()->GetAuthGameMode()))
+	{
+		GM->ProcessPickups(NumCollected);
+	}
+
+	// call the BP handler to play effects
+	BP_OnPickedUp(CollectedLocations);
+
+	// stop checking once everything is collected
+	NumRemaining -= NumCollected;
+
+	if (NumRemaining <= 0)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+void ASideScrollingPickupField::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ASideScrollingPickupField, CollectedInstances);
+}
+
+int32 ASideScrollingPickupField::CollectPickups(const APawn* Pawn, TArray<FVector>& OutLocations)
+{
+	const FVector PawnLocation = Pawn->GetActorLocation();
+	const float Reach = PickupRadius + Pawn->GetSimpleCollisionRadius();
+
+	// find the first pickup within reach along X
+	int32 Index = Algo::LowerBoundBy(SortedPickups, PawnLocation.X - Reach, &FPickupEntry::X);
+
+	int32 NumCollected = 0;
+
+	for (; Index < SortedPickups.Num() && SortedPickups[Index].X <= PawnLocation.X + Reach; ++Index)
+	{
+		const FPickupEntry& Entry = SortedPickups[Index];
+
+		if (HiddenInstances[Entry.InstanceIndex])
+		{
+			continue;
+		}
+
+		// movement is constrained to the X/Z plane, so ignore Y
+		const FVector2f Offset(Entry.X - PawnLocation.X, Entry.Z - PawnLocation.Z);
+
+		if (Offset.SizeSquared() > FMath::Square(Reach))
+		{
+			continue;
+		}
+
+		HidePickup(Entry.InstanceIndex, OutLocations);
+		CollectedInstances.Add(Entry.InstanceIndex);
+		++NumCollected;
+	}
+
+	return NumCollected;
+}
+
+bool ASideScrollingPickupField::HidePickup(int32 InstanceIndex, TArray<FVector>& OutLocations)
+{
+	if (!HiddenInstances.IsValidIndex(InstanceIndex) || HiddenInstances[InstanceIndex])
+	{
+		return false;
+	}
+
+	HiddenInstances[InstanceIndex] = true;
+
+	// hide the instance by scaling it down
+	FTransform InstanceTransform;
+	Pickups->GetInstanceTransform(InstanceIndex, InstanceTransform, true);
+
+	OutLocations.Add(InstanceTransform.GetLocation());
+
+	InstanceTransform.SetScale3D(FVector::ZeroVector);
+	Pickups->UpdateInstanceTransform(InstanceIndex, InstanceTransform, true, false, true);
+
+	return true;
+}
+
+void ASideScrollingPickupField::OnRep_CollectedInstances()
+{
+	// the initial state may arrive before BeginPlay, which hides it instead
+	if (HasActorBegunPlay())
+	{
+		HideCollectedPickups(true);
+	}
+}
+
+void ASideScrollingPickupField::HideCollectedPickups(bool bPlayEffects)
+{
+	// hide only what's new since the last update
+	TArray<FVector> CollectedLocations;
+
+	for (int32 InstanceIndex : CollectedInstances)
+	{
+		HidePickup(InstanceIndex, CollectedLocations);
+	}
+
+	if (CollectedLocations.Num() == 0)
+	{
+		return;
+	}
+
+	// hidden instances were updated without a render state update, so do it once for the whole batch
+	Pickups->MarkRenderStateDirty();
+
+	// play the effects on this machine too
+	if (bPlayEffects)
+	{
+		BP_OnPickedUp(CollectedLocations);
+	}
+}
@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SideScrollingPickupField.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+/**
+ *  A field of side scrolling pickups drawn as instances of a single mesh
+ *  Place pickups by adding instances to the Pickups component. They have no collision:
+ *  instead, the field keeps them sorted along X and checks player distances on the X/Z plane every frame.
+ *  Pickups collected on the same frame are passed to the GameMode as one batch
+ *  The server collects pickups and replicates the collected instances, which every machine hides
+ */
+UCLASS(abstract)
+class ASideScrollingPickupField : public AActor
+{
+	GENERATED_BODY()
+
+	/** Pickup instances */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UInstancedStaticMeshComponent* Pickups;
+
+protected:
+
+	/** Distance from a pickup's center to the player's collision at which it's collected */
+	UPROPERTY(EditAnywhere, Category="Pickup", meta = (ClampMin=0, ClampMax=1000, Units="cm"))
+	float PickupRadius = 60.0f;
+
+	/** A pickup sorted along X */
+	struct FPickupEntry
+	{
+		/** World X of the pickup */
+		float X = 0.0f;
+
+		/** World Z of the pickup */
+		float Z = 0.0f;
+
+		/** Pickup instance index */
+		int32 InstanceIndex = INDEX_NONE;
+	};
+
+	/** Pickups sorted by X */
+	TArray<FPickupEntry> SortedPickups;
+
+	/** Instance indices of the collected pickups, in collection order */
+	UPROPERTY(ReplicatedUsing=OnRep_CollectedInstances)
+	TArray<int32> CollectedInstances;
+
+	/** Instances hidden on this machine */
+	TBitArray<> HiddenInstances;
+
+	/** Number of pickups not collected yet */
+	int32 NumRemaining = 0;
+
+public:
+
+	/** Constructor */
+	ASideScrollingPickupField();
+
+protected:
+
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
+	/** Checks for collected pickups */
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** Sets up replication */
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Collects every pickup the pawn touches. Returns the number of pickups collected */
+	int32 CollectPickups(const APawn* Pawn, TArray<FVector>& OutLocations);
+
+	/** Hides a collected pickup instance. Returns false if it was already hidden */
+	bool HidePickup(int32 InstanceIndex, TArray<FVector>& OutLocations);
+
+	/** Hides the pickups the server collected and plays their effects */
+	UFUNCTION()
+	void OnRep_CollectedInstances();
+
+	/** Hides every replicated collected pickup that isn't hidden yet */
+	void HideCollectedPickups(bool bPlayEffects);
+
+	/** Passes control to BP to play effects on a batch of pickups */
+	UFUNCTION(BlueprintImplementableEvent, Category="Pickup", meta = (DisplayName = "On Picked Up"))
+	void BP_OnPickedUp(const TArray<FVector>& Locations);
+};
@@ -0,0 +1,202 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingPlatformMoverComponent.h"
+#include "SideScrollingPlatformSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+USideScrollingPlatformMoverComponent::USideScrollingPlatformMoverComponent()
+{
+	// platforms are moved in a batch by the platform subsystem
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void USideScrollingPlatformMoverComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	USceneComponent* Root = GetOwner()->GetRootComponent();
+
+	if (!Root || Waypoints.IsEmpty())
+	{
+		return;
+	}
+
+	// build the world space path from the starting location
+	const FTransform StartTransform = Root->GetComponentTransform();
+
+	PathPoints.Reset(Waypoints.Num() + 2);
+	PathPoints.Add(StartTransform.GetLocation());
+
+	for (const FVector& Waypoint : Waypoints)
+	{
+		PathPoints.Add(StartTransform.TransformPosition(Waypoint));
+	}
+
+	// closed loops come back to the start
+	if (Trigger == ESideScrollingPlatformTrigger::Loop && bClosedLoop)
+	{
+		PathPoints.Add(StartTransform.GetLocation());
+	}
+
+	// looping platforms start moving right away
+	State = FSideScrollingPlatformState();
+	State.bMoving = Trigger == ESideScrollingPlatformTrigger::Loop;
+
+	// register with the platform subsystem
+	if (USideScrollingPlatformSubsystem* Platforms = GetWorld()->GetSubsystem<USideScrollingPlatformSubsystem>())
+	{
+		Platforms->RegisterMover(this);
+	}
+}
+
+void USideScrollingPlatformMoverComponent::EndPlay(EEndPlayReason::Type EndPlayReason)
+{
+	if (USideScrollingPlatformSubsystem* Platforms = GetWorld()->GetSubsystem<USideScrollingPlatformSubsystem>())
+	{
+		Platforms->UnregisterMover(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USideScrollingPlatformMoverComponent::Interaction()
+{
+	// looping platforms move on their own. Ignore interactions while moving, or after a one shot platform has moved
+	if (!CanBeTriggered())
+	{
+		return;
+	}
+
+	State.bMoving = true;
+}
+
+void USideScrollingPlatformMoverComponent::SetPlatformState(const FSideScrollingPlatformState& NewState)
+{
+	State = NewState;
+	State.Segment = FMath::Clamp(State.Segment, 0, FMath::Max(0, GetNumSegments() - 1));
+	State.Alpha = FMath::Clamp(State.Alpha, 0.0f, 1.0f);
+	State.Direction = State.Direction < 0 ? -1 : 1;
+
+	if (USceneComponent* Root = GetOwner()->GetRootComponent(); Root && GetNumSegments() > 0)
+	{
+		// teleport so based characters aren't dragged along
+		Root->SetWorldLocation(GetStateLocation(), false, nullptr, ETeleportType::TeleportPhysics);
+		Root->ComponentVelocity = FVector::ZeroVector;
+	}
+}
+
+void USideScrollingPlatformMoverComponent::UpdatePlatform(float DeltaTime)
+{
+	USceneComponent* Root = GetOwner()->GetRootComponent();
+
+	if (!Root || GetNumSegments() == 0 || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// stopped platforms only need their velocity cleared
+	if (!State.bMoving)
+	{
+		Root->ComponentVelocity = FVector::ZeroVector;
+		return;
+	}
+
+	// wait at the current waypoint
+	if (State.PauseRemaining > 0.0f)
+	{
+		State.PauseRemaining -= DeltaTime;
+		Root->ComponentVelocity = FVector::ZeroVector;
+		return;
+	}
+
+	AdvanceState(DeltaTime);
+
+	// move the platform and derive its velocity from the actual motion, so based characters inherit it
+	const FVector OldLocation = Root->GetComponentLocation();
+	const FVector NewLocation = GetStateLocation();
+
+	Root->SetWorldLocation(NewLocation);
+	Root->ComponentVelocity = (NewLocation - OldLocation) / DeltaTime;
+}
+
+void USideScrollingPlatformMoverComponent::AdvanceState(float DeltaTime)
+{
+	State.Alpha += State.Direction * DeltaTime / SegmentDuration;
+
+	// still between waypoints?
+	if (State.Alpha > 0.0f && State.Alpha < 1.0f)
+	{
+		return;
+	}
+
+	// we reached a waypoint, so clamp to it
+	const bool bForward = State.Direction > 0;
+	State.Alpha = bForward ? 1.0f : 0.0f;
+
+	const int32 NextSegment = State.Segment + State.Direction;
+
+	// move on to the next segment
+	if (NextSegment >= 0 && NextSegment < GetNumSegments())
+	{
+		State.Segment = NextSegment;
+		State.Alpha = bForward ? 0.0f : 1.0f;
+
+		if (Trigger == ESideScrollingPlatformTrigger::Loop)
+		{
+			State.PauseRemaining = WaypointPause;
+		}
+
+		return;
+	}
+
+	ReachEndOfPath();
+}
+
+void USideScrollingPlatformMoverComponent::ReachEndOfPath()
+{
+	switch (Trigger)
+	{
+	case ESideScrollingPlatformTrigger::Loop:
+
+		State.PauseRemaining = WaypointPause;
+
+		// closed loops end where they start, so wrap around. Otherwise go back along the path
+		if (bClosedLoop)
+		{
+			State.Segment = 0;
+			State.Alpha = 0.0f;
+
+		} else {
+
+			State.Direction = -State.Direction;
+		}
+
+		break;
+
+	case ESideScrollingPlatformTrigger::Interaction:
+
+		// wait for the next interaction to go back
+		State.bMoving = false;
+		State.Direction = -State.Direction;
+		break;
+
+	case ESideScrollingPlatformTrigger::OneShot:
+
+		// stay here for good
+		State.bMoving = false;
+		State.bSpent = true;
+		break;
+	}
+
+	OnPlatformArrived.Broadcast();
+}
+
+FVector USideScrollingPlatformMoverComponent::GetStateLocation() const
+{
+	const double EasedAlpha = UKismetMathLibrary::Ease(0.0f, 1.0f, State.Alpha, Easing, EasingExponent);
+
+	return FMath::Lerp(PathPoints[State.Segment], PathPoints[State.Segment + 1], EasedAlpha);
+}
@@ -0,0 +1,155 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "SideScrollingPlatformMoverComponent.generated.h"
+
+/**
+ *  How a moving platform is set in motion
+ */
+UENUM(BlueprintType)
+enum class ESideScrollingPlatformTrigger : uint8
+{
+	Loop			UMETA(ToolTip = "Moves on its own from BeginPlay"),
+	Interaction		UMETA(ToolTip = "Each interaction moves the platform to the other end of its path"),
+	OneShot			UMETA(ToolTip = "The first interaction moves the platform to the end of its path, where it stays"),
+};
+
+/**
+ *  Moving platform state. Can be saved and restored for checkpoints
+ */
+USTRUCT(BlueprintType)
+struct FSideScrollingPlatformState
+{
+	GENERATED_BODY()
+
+	/** Path segment the platform is on */
+	UPROPERTY(SaveGame, BlueprintReadWrite, Category="Moving Platform")
+	int32 Segment = 0;
+
+	/** Progress along the segment, from 0 to 1 */
+	UPROPERTY(SaveGame, BlueprintReadWrite, Category="Moving Platform")
+	float Alpha = 0.0f;
+
+	/** 1 when moving towards the end of the path, -1 when moving back */
+	UPROPERTY(SaveGame, BlueprintReadWrite, Category="Moving Platform")
+	int32 Direction = 1;
+
+	/** Time left to wait at the current waypoint */
+	UPROPERTY(SaveGame, BlueprintReadWrite, Category="Moving Platform")
+	float PauseRemaining = 0.0f;
+
+	/** True while the platform is moving */
+	UPROPERTY(SaveGame, BlueprintReadWrite, Category="Moving Platform")
+	bool bMoving = false;
+
+	/** True once a one shot platform has moved */
+	UPROPERTY(SaveGame, BlueprintReadWrite, Category="Moving Platform")
+	bool bSpent = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSideScrollingPlatformArrivedDelegate);
+
+/**
+ *  Natively moves its owner's root component along a path of waypoints, with easing between them.
+ *  Doesn't tick on its own: every platform in the world is moved in one batch by
+ *  USideScrollingPlatformSubsystem before character movement runs, so based characters never lag a frame behind.
+ *  Sets the root component velocity so characters jumping off the platform inherit its motion.
+ */
+UCLASS(ClassGroup="Side Scrolling", meta=(BlueprintSpawnableComponent))
+class USideScrollingPlatformMoverComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Waypoints relative to the platform's starting location. The starting location is the first point of the path */
+	UPROPERTY(EditAnywhere, Category="Moving Platform", meta = (MakeEditWidget))
+	TArray<FVector> Waypoints;
+
+	/** Time to travel between two waypoints */
+	UPROPERTY(EditAnywhere, Category="Moving Platform", meta = (ClampMin = 0.01, ClampMax = 60, Units="s"))
+	float SegmentDuration = 2.0f;
+
+	/** Easing applied to each segment */
+	UPROPERTY(EditAnywhere, Category="Moving Platform")
+	TEnumAsByte<EEasingFunc::Type> Easing = EEasingFunc::EaseInOut;
+
+	/** Blend exponent for the ease in and out functions */
+	UPROPERTY(EditAnywhere, Category="Moving Platform", meta = (ClampMin = 1, ClampMax = 10))
+	float EasingExponent = 2.0f;
+
+	/** How the platform is set in motion */
+	UPROPERTY(EditAnywhere, Category="Moving Platform")
+	ESideScrollingPlatformTrigger Trigger = ESideScrollingPlatformTrigger::Loop;
+
+	/** If true, looping platforms return to the start from the last waypoint instead of going back along the path */
+	UPROPERTY(EditAnywhere, Category="Moving Platform", meta = (EditCondition = "Trigger == ESideScrollingPlatformTrigger::Loop"))
+	bool bClosedLoop = false;
+
+	/** Time looping platforms wait at each waypoint */
+	UPROPERTY(EditAnywhere, Category="Moving Platform", meta = (ClampMin = 0, ClampMax = 60, Units="s", EditCondition = "Trigger == ESideScrollingPlatformTrigger::Loop"))
+	float WaypointPause = 0.0f;
+
+	/** Current platform state */
+	UPROPERTY(VisibleInstanceOnly, SaveGame, Category="Moving Platform")
+	FSideScrollingPlatformState State;
+
+	/** World space path, built at BeginPlay */
+	TArray<FVector> PathPoints;
+
+public:
+
+	/** Called when the platform reaches the end of its path */
+	UPROPERTY(BlueprintAssignable, Category="Moving Platform")
+	FSideScrollingPlatformArrivedDelegate OnPlatformArrived;
+
+public:
+
+	/** Constructor */
+	USideScrollingPlatformMoverComponent();
+
+	/** Returns true if the platform has waypoints to move along */
+	bool HasPath() const { return !Waypoints.IsEmpty(); }
+
+	/** Starts moving an interaction triggered platform. Ignored while it's moving */
+	UFUNCTION(BlueprintCallable, Category="Moving Platform")
+	void Interaction();
+
+	/** Returns true if an interaction would set the platform in motion */
+	bool CanBeTriggered() const { return Trigger != ESideScrollingPlatformTrigger::Loop && !State.bMoving && !State.bSpent; }
+
+	/** Returns the platform state, e.g. to save it at a checkpoint */
+	UFUNCTION(BlueprintPure, Category="Moving Platform")
+	const FSideScrollingPlatformState& GetPlatformState() const { return State; }
+
+	/** Restores a saved platform state, teleporting the platform to match */
+	UFUNCTION(BlueprintCallable, Category="Moving Platform")
+	void SetPlatformState(const FSideScrollingPlatformState& NewState);
+
+	/** Moves the platform. Called by the platform subsystem once per frame */
+	void UpdatePlatform(float DeltaTime);
+
+protected:
+
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
+	/** Gameplay cleanup */
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+	/** Advances the state along the path */
+	void AdvanceState(float DeltaTime);
+
+	/** Handles reaching the end of the path */
+	void ReachEndOfPath();
+
+	/** Returns the world location for the current state */
+	FVector GetStateLocation() const;
+
+	/** Returns the number of segments in the path */
+	int32 GetNumSegments() const { return FMath::Max(0, PathPoints.Num() - 1); }
+};
@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingPlatformSubsystem.h"
+#include "SideScrollingPlatformMoverComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+void FSideScrollingPlatformTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->TickPlatforms(DeltaTime);
+	}
+}
+
+FString FSideScrollingPlatformTickFunction::DiagnosticMessage()
+{
+	return TEXT("FSideScrollingPlatformTickFunction");
+}
+
+FName FSideScrollingPlatformTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("SideScrollingPlatforms"));
+}
+
+void USideScrollingPlatformSubsystem::RegisterMover(USideScrollingPlatformMoverComponent* Mover)
+{
+	Movers.AddUnique(Mover);
+
+	// only tick while there are platforms to move
+	PlatformTick.SetTickFunctionEnable(true);
+}
+
+void USideScrollingPlatformSubsystem::UnregisterMover(USideScrollingPlatformMoverComponent* Mover)
+{
+	Movers.RemoveSwap(Mover);
+
+	if (Movers.IsEmpty())
+	{
+		PlatformTick.SetTickFunctionEnable(false);
+	}
+}
+
+void USideScrollingPlatformSubsystem::TickPlatforms(float DeltaTime)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_SideScrollingPlatforms_Tick);
+
+	for (int32 Index = Movers.Num() - 1; Index >= 0; --Index)
+	{
+		if (USideScrollingPlatformMoverComponent* Mover = Movers[Index].Get())
+		{
+			Mover->UpdatePlatform(DeltaTime);
+
+		} else {
+
+			Movers.RemoveAtSwap(Index);
+		}
+	}
+}
+
+bool USideScrollingPlatformSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// only move platforms in game worlds
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void USideScrollingPlatformSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// register the batched tick before character movement
+	PlatformTick.Subsystem = this;
+	PlatformTick.TickGroup = TG_PrePhysics;
+	PlatformTick.bCanEverTick = true;
+	PlatformTick.bHighPriority = true;
+	PlatformTick.SetTickFunctionEnable(!Movers.IsEmpty());
+	PlatformTick.RegisterTickFunction(InWorld.PersistentLevel);
+
+	// order the character movement after the platforms
+	for (TActorIterator<ACharacter> It(&InWorld); It; ++It)
+	{
+		AddMovementPrerequisite(*It);
+	}
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &USideScrollingPlatformSubsystem::OnActorSpawned));
+}
+
+void USideScrollingPlatformSubsystem::Deinitialize()
+{
+	if (PlatformTick.IsTickFunctionRegistered())
+	{
+		PlatformTick.UnRegisterTickFunction();
+	}
+
+	GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+
+	Movers.Reset();
+
+	Super::Deinitialize();
+}
+
+void USideScrollingPlatformSubsystem::AddMovementPrerequisite(ACharacter* Character)
+{
+	if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+	{
+		Movement->PrimaryComponentTick.AddPrerequisite(this, PlatformTick);
+	}
+}
+
+void USideScrollingPlatformSubsystem::OnActorSpawned(AActor* SpawnedActor)
+{
+	if (ACharacter* Character = Cast<ACharacter>(SpawnedActor))
+	{
+		AddMovementPrerequisite(Character);
+	}
+}
@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SideScrollingPlatformSubsystem.generated.h"
+
+class USideScrollingPlatformMoverComponent;
+class USideScrollingPlatformSubsystem;
+class ACharacter;
+
+/**
+ *  Tick function that moves every platform in the world in one batch
+ */
+struct FSideScrollingPlatformTickFunction : public FTickFunction
+{
+	/** Subsystem that owns the platforms */
+	USideScrollingPlatformSubsystem* Subsystem = nullptr;
+
+	// ~begin FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+	// ~end FTickFunction interface
+};
+
+/**
+ *  Moves all native moving platforms in the world in a single tick.
+ *  The batch runs in TG_PrePhysics, and every character's movement is made to tick after it,
+ *  so characters always see where their base is this frame.
+ */
+UCLASS()
+class USideScrollingPlatformSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/** Batched platform tick */
+	FSideScrollingPlatformTickFunction PlatformTick;
+
+	/** Registered platform movers */
+	TArray<TWeakObjectPtr<USideScrollingPlatformMoverComponent>> Movers;
+
+	/** Handle for the actor spawned callback */
+	FDelegateHandle ActorSpawnedHandle;
+
+public:
+
+	/** Adds a platform mover to the batch */
+	void RegisterMover(USideScrollingPlatformMoverComponent* Mover);
+
+	/** Removes a platform mover from the batch */
+	void UnregisterMover(USideScrollingPlatformMoverComponent* Mover);
+
+	/** Moves every registered platform */
+	void TickPlatforms(float DeltaTime);
+
+public:
+
+	// ~begin UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	// ~end UWorldSubsystem interface
+
+protected:
+
+	/** Makes a character's movement tick after the platforms */
+	void AddMovementPrerequisite(ACharacter* Character);
+
+	/** Handles characters spawned during play */
+	void OnActorSpawned(AActor* SpawnedActor);
+};
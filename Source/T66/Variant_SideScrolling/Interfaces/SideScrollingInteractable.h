@@ -28,4 +28,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Interactable")
 	virtual void Interaction(AActor* Interactor) = 0;
 
+	/** Returns true if the provided Actor can interact with us right now */
+	virtual bool CanInteract(const AActor* Interactor) const { return true; }
+
 };
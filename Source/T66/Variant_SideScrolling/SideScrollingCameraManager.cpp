@@ -6,6 +6,9 @@
 #include "Engine/HitResult.h"
 #include "CollisionQueryParams.h"
 #include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Algo/UpperBound.h"
+#include "SideScrollingCameraHeightField.h"
 
 void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime)
 {
@@ -25,8 +28,11 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 		// copy the current camera location
 		FVector CurrentCameraLocation = GetCameraLocation();
 
+		// find the camera settings for this stretch of the level
+		const FSideScrollingCameraSegment& Segment = FindCameraSegment(CurrentActorLocation.X);
+
 		// calculate the "zoom distance" - in reality the distance we want to keep to the target
-		float CurrentY = CurrentZoom + CurrentActorLocation.Y;
+		float CurrentY = Segment.Zoom + CurrentActorLocation.Y;
 
 		// do first-time setup
 		if (bSetup)
@@ -34,6 +40,9 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 			// lower the setup flag
 			bSetup = false;
 
+			// find the baked ground data
+			GatherHeightFields();
+
 			// initialize the camera viewpoint and return
 			OutVT.POV.Location.X = CurrentActorLocation.X;
 			OutVT.POV.Location.Y = CurrentY;
@@ -49,29 +58,30 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 		// check if the camera needs to update its height
 		bool bZUpdate = false;
 
-		// is the character moving vertically?
-		if (FMath::IsNearlyZero(TargetPawn->GetVelocity().Z))
+		// is the camera on a rail?
+		if (Segment.bRail)
+		{
+			// rails don't follow the target's height, so skip the ground check
+
+		} else if (FMath::IsNearlyZero(TargetPawn->GetVelocity().Z))
 		{
 			// determine if we need to do a height update
-			bZUpdate = FMath::IsNearlyEqual(CurrentZ, CurrentCameraLocation.Z, 25.0f);
+			bZUpdate = FMath::IsNearlyEqual(CurrentZ + Segment.ZOffset, CurrentCameraLocation.Z, 25.0f);
 
 		} else {
 
-			// run a trace below the character to determine if we need to do a height update
-			FHitResult OutHit;
-
-			const FVector End = CurrentActorLocation + FVector(0.0f, 0.0f, -1000.0f);
-
-			FCollisionQueryParams QueryParams;
-			QueryParams.AddIgnoredActor(TargetPawn);
-
 			// only update height if we're not about to hit ground
-			bZUpdate = !GetWorld()->LineTraceSingleByChannel(OutHit, CurrentActorLocation, End, ECC_Visibility, QueryParams);
+			bZUpdate = !HasGroundBelow(TargetPawn, CurrentActorLocation);
 
 		}
 
 		// do we need to do a height update?
-		if (bZUpdate)
+		if (Segment.bRail)
+		{
+			// blend the height towards the rail
+			CurrentZ = FMath::FInterpTo(CurrentZ, Segment.RailZ, DeltaTime, Segment.HeightInterpSpeed);
+
+		} else if (bZUpdate)
 		{
 
 			// set the height goal from the actor location
@@ -88,18 +98,159 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 			} else {
 
 				// blend the height towards the actor location
-				CurrentZ = FMath::FInterpTo(CurrentZ, CurrentActorLocation.Z, DeltaTime, 2.0f);
+				CurrentZ = FMath::FInterpTo(CurrentZ, CurrentActorLocation.Z, DeltaTime, Segment.HeightInterpSpeed);
 				
 			}
 
 		}
 
 		// clamp the X axis to the min and max camera bounds
-		float CurrentX = FMath::Clamp(CurrentActorLocation.X, CameraXMinBounds, CameraXMaxBounds);
+		float CurrentX = FMath::Clamp(CurrentActorLocation.X, Segment.BoundsMinX, Segment.BoundsMaxX);
 
 		// blend towards the new camera location and update the output
-		FVector TargetCameraLocation(CurrentX, CurrentY, CurrentZ);
+		FVector TargetCameraLocation(CurrentX, CurrentY, CurrentZ + Segment.ZOffset);
+
+		OutVT.POV.Location = FMath::VInterpTo(CurrentCameraLocation, TargetCameraLocation, DeltaTime, Segment.InterpSpeed);
+	}
+}
+
+void ASideScrollingCameraManager::BeginPlay()
+{
+	Super::BeginPlay();
+
+	BuildCameraSegments();
+}
+
+void ASideScrollingCameraManager::BuildCameraSegments()
+{
+	// the default settings come from the camera manager's own properties
+	DefaultSegment = FSideScrollingCameraSegment();
+	DefaultSegment.Zoom = CurrentZoom;
+	DefaultSegment.BoundsMinX = CameraXMinBounds;
+	DefaultSegment.BoundsMaxX = CameraXMaxBounds;
+
+	CameraSegments.Reset();
+
+	TArray<FSideScrollingCameraSegment> VolumeSegments;
+	TArray<float> Boundaries;
+
+	for (TActorIterator<ASideScrollingCameraVolume> It(GetWorld()); It; ++It)
+	{
+		const FSideScrollingCameraSegment& Segment = VolumeSegments.Add_GetRef(It->MakeSegment());
+
+		Boundaries.Add(Segment.MinX);
+		Boundaries.Add(Segment.MaxX);
+	}
+
+	Boundaries.Sort();
+
+	// resolve every range between two volume edges: where volumes overlap, the one that starts further along takes over,
+	// so a volume nested inside another wins inside it and the outer one resumes past its end
+	int32 LastWinner = INDEX_NONE;
+
+	for (int32 Index = 0; Index + 1 < Boundaries.Num(); ++Index)
+	{
+		const float RangeMinX = Boundaries[Index];
+		const float RangeMaxX = Boundaries[Index + 1];
+
+		if (RangeMaxX - RangeMinX <= UE_KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		int32 Winner = INDEX_NONE;
+
+		for (int32 SegmentIndex = 0; SegmentIndex < VolumeSegments.Num(); ++SegmentIndex)
+		{
+			const FSideScrollingCameraSegment& Segment = VolumeSegments[SegmentIndex];
+
+			if (Segment.MinX > RangeMinX || Segment.MaxX < RangeMaxX)
+			{
+				continue;
+			}
+
+			// ties go to the narrower volume
+			if (Winner == INDEX_NONE || Segment.MinX > VolumeSegments[Winner].MinX
+				|| (Segment.MinX == VolumeSegments[Winner].MinX && Segment.MaxX < VolumeSegments[Winner].MaxX))
+			{
+				Winner = SegmentIndex;
+			}
+		}
+
+		// not covered by any volume, so it uses the default segment
+		if (Winner == INDEX_NONE)
+		{
+			LastWinner = INDEX_NONE;
+			continue;
+		}
+
+		// extend the previous range while the same volume wins
+		if (Winner == LastWinner && CameraSegments.Last().MaxX == RangeMinX)
+		{
+			CameraSegments.Last().MaxX = RangeMaxX;
+			continue;
+		}
+
+		FSideScrollingCameraSegment& Resolved = CameraSegments.Add_GetRef(VolumeSegments[Winner]);
+		Resolved.MinX = RangeMinX;
+		Resolved.MaxX = RangeMaxX;
+
+		LastWinner = Winner;
+	}
+}
+
+void ASideScrollingCameraManager::RefreshLevelData()
+{
+	GatherHeightFields();
+	BuildCameraSegments();
+}
+
+const FSideScrollingCameraSegment& ASideScrollingCameraManager::FindCameraSegment(float X) const
+{
+	// find the last segment that starts at or before X
+	const int32 Index = Algo::UpperBoundBy(CameraSegments, X, &FSideScrollingCameraSegment::MinX) - 1;
+
+	if (CameraSegments.IsValidIndex(Index) && X <= CameraSegments[Index].MaxX)
+	{
+		return CameraSegments[Index];
+	}
+
+	return DefaultSegment;
+}
+
+bool ASideScrollingCameraManager::HasGroundBelow(const APawn* TargetPawn, const FVector& TargetLocation) const
+{
+	// read from the baked height fields first
+	for (const TWeakObjectPtr<ASideScrollingCameraHeightField>& HeightField : HeightFields)
+	{
+		bool bHasGround = false;
+
+		if (HeightField.IsValid() && HeightField->FindGroundBelow(TargetLocation, GroundCheckDistance, bHasGround))
+		{
+			return bHasGround;
+		}
+	}
 
-		OutVT.POV.Location = FMath::VInterpTo(CurrentCameraLocation, TargetCameraLocation, DeltaTime, 2.0f);
+	// no baked data here, so run a trace below the character
+	FHitResult OutHit;
+
+	const FVector End = TargetLocation + FVector(0.0f, 0.0f, -GroundCheckDistance);
+
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(TargetPawn);
+
+	return GetWorld()->LineTraceSingleByChannel(OutHit, TargetLocation, End, ECC_Visibility, QueryParams);
+}
+
+void ASideScrollingCameraManager::GatherHeightFields()
+{
+	HeightFields.Reset();
+
+	for (TActorIterator<ASideScrollingCameraHeightField> It(GetWorld()); It; ++It)
+	{
+		if (It->HasBakedData())
+		{
+			HeightFields.Add(*It);
+		}
 	}
-}
\ No newline at end of file
+}
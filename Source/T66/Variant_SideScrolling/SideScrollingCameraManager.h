@@ -4,10 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Camera/PlayerCameraManager.h"
+#include "SideScrollingCameraVolume.h"
 #include "SideScrollingCameraManager.generated.h"
 
+class ASideScrollingCameraHeightField;
+
 /**
  *  Simple side scrolling camera with smooth scrolling and horizontal bounds
+ *  Ground checks read from baked ASideScrollingCameraHeightField actors, and only trace where there's no baked data
+ *  ASideScrollingCameraVolume actors override the zoom, bounds, height and blend speeds along stretches of the level
  */
 UCLASS()
 class ASideScrollingCameraManager : public APlayerCameraManager
@@ -19,6 +24,15 @@ public:
 	/** Overrides the default camera view target calculation */
 	virtual void UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime) override;
 
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
+	/** Compiles the camera volumes in the world into camera segments. Call again if volumes are streamed in or out */
+	void BuildCameraSegments();
+
+	/** Refreshes the height fields and camera segments after level chunks are streamed in or out */
+	void RefreshLevelData();
+
 public:
 
 	/** How close we want to stay to the view target */
@@ -37,8 +51,32 @@ public:
 	UPROPERTY(EditAnywhere, Category="Side Scrolling Camera", meta=(ClampMin=-100000, ClampMax=100000, Units="cm"))
 	float CameraXMaxBounds = 10000.0f;
 
+	/** Max distance below the target to look for ground before following it vertically */
+	UPROPERTY(EditAnywhere, Category="Side Scrolling Camera", meta=(ClampMin=0, ClampMax=10000, Units="cm"))
+	float GroundCheckDistance = 1000.0f;
+
+protected:
+
+	/** Returns the camera segment covering a location along X, or the default settings if there's none */
+	const FSideScrollingCameraSegment& FindCameraSegment(float X) const;
+
+	/** Returns true if there's ground within the ground check distance below the target */
+	bool HasGroundBelow(const APawn* TargetPawn, const FVector& TargetLocation) const;
+
+	/** Finds the baked height fields in the world */
+	void GatherHeightFields();
+
 protected:
 
+	/** Camera segments compiled from the camera volumes, sorted by MinX and not overlapping */
+	TArray<FSideScrollingCameraSegment> CameraSegments;
+
+	/** Camera settings used outside of any camera volume */
+	FSideScrollingCameraSegment DefaultSegment;
+
+	/** Baked height fields in the world */
+	TArray<TWeakObjectPtr<ASideScrollingCameraHeightField>> HeightFields;
+
 	/** Last cached camera vertical location. The camera only adjusts its height if necessary. */
 	float CurrentZ = 0.0f;
 
@@ -11,10 +11,13 @@
 #include "InputAction.h"
 #include "Engine/World.h"
 #include "SideScrollingInteractable.h"
-#include "Kismet/KismetMathLibrary.h"
-#include "TimerManager.h"
+#include "SideScrollingInteractionSubsystem.h"
+#include "T66CharacterMovementComponent.h"
+#include "T66GhostRecorderComponent.h"
+#include "T66InputLatency.h"
 
-ASideScrollingCharacter::ASideScrollingCharacter()
+ASideScrollingCharacter::ASideScrollingCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UT66CharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
@@ -24,6 +27,9 @@ ASideScrollingCharacter::ASideScrollingCharacter()
 
 	Camera->SetRelativeLocationAndRotation(FVector(0.0f, 300.0f, 0.0f), FRotator(0.0f, -90.0f, 0.0f));
 
+	// create the ghost recorder
+	GhostRecorder = CreateDefaultSubobject<UT66GhostRecorderComponent>(TEXT("GhostRecorder"));
+
 	// configure the collision capsule
 	GetCapsuleComponent()->SetCapsuleSize(35.0f, 90.0f);
 
@@ -57,15 +63,47 @@ ASideScrollingCharacter::ASideScrollingCharacter()
 
 	// enable double jump and coyote time
 	JumpMaxCount = 3;
+
+	// configure the wall jump. Walls are only checked along the horizontal input
+	UT66CharacterMovementComponent* T66Movement = GetT66CharacterMovement();
+
+	T66Movement->WallJumpTraceDistance = 50.0f;
+	T66Movement->WallJumpTraceRadius = 0.0f;
+	T66Movement->bWallJumpRequiresInput = true;
+	T66Movement->WallJumpHorizontalImpulse = 500.0f;
+	T66Movement->WallJumpVerticalMultiplier = 1.4f;
+	T66Movement->DelayBetweenWallJumps = 0.3f;
+	T66Movement->MaxCoyoteTime = 0.16f;
 }
 
-void ASideScrollingCharacter::EndPlay(EEndPlayReason::Type EndPlayReason)
+#if WITH_EDITORONLY_DATA
+void ASideScrollingCharacter::PostLoad()
 {
-	Super::EndPlay(EndPlayReason);
+	Super::PostLoad();
+
+	UT66CharacterMovementComponent* T66Movement = GetT66CharacterMovement();
+
+	if (!T66Movement)
+	{
+		return;
+	}
+
+	// only forward values a Blueprint changed from the old defaults, so overrides made on the component are kept
+	auto Forward = [](float DeprecatedValue, float OldDefault, float& NewValue)
+	{
+		if (!FMath::IsNearlyEqual(DeprecatedValue, OldDefault))
+		{
+			NewValue = DeprecatedValue;
+		}
+	};
 
-	// clear the wall jump timer
-	GetWorld()->GetTimerManager().ClearTimer(WallJumpTimer);
+	Forward(DelayBetweenWallJumps_DEPRECATED, 0.3f, T66Movement->DelayBetweenWallJumps);
+	Forward(WallJumpTraceDistance_DEPRECATED, 50.0f, T66Movement->WallJumpTraceDistance);
+	Forward(WallJumpHorizontalImpulse_DEPRECATED, 500.0f, T66Movement->WallJumpHorizontalImpulse);
+	Forward(WallJumpVerticalMultiplier_DEPRECATED, 1.4f, T66Movement->WallJumpVerticalMultiplier);
+	Forward(MaxCoyoteTime_DEPRECATED, 0.16f, T66Movement->MaxCoyoteTime);
 }
+#endif
 
 void ASideScrollingCharacter::SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent)
 {
@@ -91,6 +129,17 @@ void ASideScrollingCharacter::SetupPlayerInputComponent(class UInputComponent* P
 	}
 }
 
+void ASideScrollingCharacter::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// only the local player needs interaction prompts
+	if (IsLocallyControlled())
+	{
+		UpdateInteractionCandidates();
+	}
+}
+
 void ASideScrollingCharacter::NotifyHit(class UPrimitiveComponent* MyComp, AActor* Other, class UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit)
 {
 	Super::NotifyHit(MyComp, Other, OtherComp, bSelfMoved, HitLocation, HitNormal, NormalImpulse, Hit);
@@ -115,24 +164,6 @@ void ASideScrollingCharacter::NotifyHit(class UPrimitiveComponent* MyComp, AActo
 	}
 }
 
-void ASideScrollingCharacter::Landed(const FHitResult& Hit)
-{
-	// reset the double jump
-	bHasDoubleJumped = false;
-}
-
-void ASideScrollingCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode /*= 0*/)
-{
-	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
-
-	// are we falling?
-	if (GetCharacterMovement()->MovementMode == EMovementMode::MOVE_Falling)
-	{
-		// save the game time when we started falling, so we can check it later for coyote time jumps
-		LastFallTime = GetWorld()->GetTimeSeconds();
-	}
-}
-
 void ASideScrollingCharacter::Move(const FInputActionValue& Value)
 {
 	FVector2D MoveVector = Value.Get<FVector2D>();
@@ -156,7 +187,7 @@ void ASideScrollingCharacter::DropReleased(const FInputActionValue& Value)
 void ASideScrollingCharacter::DoMove(float Forward)
 {
 	// is movement temporarily disabled after wall jumping?
-	if (!bHasWallJumped)
+	if (!HasWallJumped())
 	{
 		// save the movement values
 		ActionValueY = Forward;
@@ -177,6 +208,9 @@ void ASideScrollingCharacter::DoDrop(float Value)
 
 void ASideScrollingCharacter::DoJumpStart()
 {
+	// start measuring the input latency up to the applied jump
+	FT66InputLatency::BeginAction(ET66InputLatencyAction::Jump, this);
+
 	// handle advanced jump behaviors
 	MultiJump();
 }
@@ -188,30 +222,13 @@ void ASideScrollingCharacter::DoJumpEnd()
 
 void ASideScrollingCharacter::DoInteract()
 {
-	// do a sphere trace to look for interactive objects
-	FHitResult OutHit;
-
-	const FVector Start = GetActorLocation();
-	const FVector End = Start + FVector(100.0f, 0.0f, 0.0f);
-
-	FCollisionShape ColSphere;
-	ColSphere.SetSphere(InteractionRadius);
-
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
-
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	// refresh the candidates so the press acts on what's in reach right now
+	UpdateInteractionCandidates();
 
-	if (GetWorld()->SweepSingleByObjectType(OutHit, Start, End, FQuat::Identity, ObjectParams, ColSphere, QueryParams))
+	// interact with the best candidate
+	if (ISideScrollingInteractable* Interactable = Cast<ISideScrollingInteractable>(InteractionCandidate.Get()))
 	{
-		// have we hit an interactable?
-		if (ISideScrollingInteractable* Interactable = Cast<ISideScrollingInteractable>(OutHit.GetActor()))
-		{
-			// interact
-			Interactable->Interaction(this);
-		}
+		Interactable->Interaction(this);
 	}
 }
 
@@ -220,131 +237,80 @@ void ASideScrollingCharacter::MultiJump()
 	// does the user want to drop to a lower platform?
 	if (DropValue > 0.0f)
 	{
-		CheckForSoftCollision();
+		// reset the drop value
+		DropValue = 0.0f;
+
+		// drop through the one-way platform we're standing on, if any
+		GetT66CharacterMovement()->RequestDropThrough();
 		return;
 	}
 
 	// reset the drop value
 	DropValue = 0.0f;
 
-	// if we're grounded, disregard advanced jump logic
-	if (!GetCharacterMovement()->IsFalling())
-	{
-		Jump();
-		return;
-	}
-
-	// if we have a horizontal input, try for wall jump first
-	if (!bHasWallJumped && !FMath::IsNearlyZero(ActionValueY))
-	{
-		// trace ahead of the character for walls
-		FHitResult OutHit;
-
-		const FVector Start = GetActorLocation();
-		const FVector End = Start + (FVector(ActionValueY > 0.0f ? 1.0f : -1.0f, 0.0f, 0.0f) * WallJumpTraceDistance);
-
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(this);
-
-		GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, QueryParams);
-
-		if (OutHit.bBlockingHit)
-		{
-			// rotate to the bounce direction
-			const FRotator BounceRot = UKismetMathLibrary::MakeRotFromX(OutHit.ImpactNormal);
-			SetActorRotation(FRotator(0.0f, BounceRot.Yaw, 0.0f));
-
-			// calculate the impulse vector
-			FVector WallJumpImpulse = OutHit.ImpactNormal * WallJumpHorizontalImpulse;
-			WallJumpImpulse.Z = GetCharacterMovement()->JumpZVelocity * WallJumpVerticalMultiplier;
+	// let the movement component resolve ground, coyote, double and wall jumps
+	GetT66CharacterMovement()->HandleJumpPressed();
+}
 
-			// launch the character away from the wall
-			LaunchCharacter(WallJumpImpulse, true, true);
+void ASideScrollingCharacter::UpdateInteractionCandidates()
+{
+	TArray<AActor*> Candidates;
 
-			// enable wall jump lockout for a bit
-			bHasWallJumped = true;
+	if (USideScrollingInteractionSubsystem* Interactions = USideScrollingInteractionSubsystem::Get(this))
+	{
+		Interactions->FindCandidates(this, InteractionRadius, Candidates);
+	}
 
-			// schedule wall jump lockout reset
-			GetWorld()->GetTimerManager().SetTimer(WallJumpTimer, this, &ASideScrollingCharacter::ResetWallJump, DelayBetweenWallJumps, false);
+	InteractionCandidates.Reset(Candidates.Num());
 
-			return;
-		}
+	for (AActor* Candidate : Candidates)
+	{
+		InteractionCandidates.Add(Candidate);
 	}
 
+	// has the best candidate changed?
+	AActor* NewCandidate = Candidates.IsEmpty() ? nullptr : Candidates[0];
 
-
-	// test for double jump only if we haven't already tested for wall jump
-	if (!bHasWallJumped)
+	if (NewCandidate != InteractionCandidate.Get())
 	{
-		// are we still within coyote time frames?
-		if (GetWorld()->GetTimeSeconds() - LastFallTime < MaxCoyoteTime)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Coyote Jump"));
-
-			// use the built-in CMC functionality to do the jump
-			Jump();
-
-		// no coyote time jump
-		} else {
-		
-			// The movement component handles double jump but we still need to manage the flag for animation
-			if (!bHasDoubleJumped)
-			{
-				// raise the double jump flag
-				bHasDoubleJumped = true;
-
-				// let the CMC handle jump
-				Jump();
-			}
-		}
+		InteractionCandidate = NewCandidate;
+
+		// let BP update the highlight
+		BP_OnInteractionCandidateChanged(NewCandidate);
 	}
 }
 
-void ASideScrollingCharacter::CheckForSoftCollision()
+TArray<AActor*> ASideScrollingCharacter::GetInteractionCandidates() const
 {
-	// reset the drop value
-	DropValue = 0.0f;
-
-	// trace down 
-	FHitResult OutHit;
-
-	const FVector Start = GetActorLocation();
-	const FVector End = Start + (FVector::DownVector * SoftCollisionTraceDistance);
-
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(SoftCollisionObjectType);
-
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	TArray<AActor*> Candidates;
 
-	GetWorld()->LineTraceSingleByObjectType(OutHit, Start, End, ObjectParams, QueryParams);
-
-	// did we hit a soft floor?
-	if (OutHit.GetActor())
+	for (const TWeakObjectPtr<AActor>& Candidate : InteractionCandidates)
 	{
-		// drop through the floor
-		SetSoftCollision(true);
+		if (AActor* Actor = Candidate.Get())
+		{
+			Candidates.Add(Actor);
+		}
 	}
+
+	return Candidates;
 }
 
-void ASideScrollingCharacter::ResetWallJump()
+bool ASideScrollingCharacter::HasDoubleJumped() const
 {
-	// reset the wall jump flag
-	bHasWallJumped = false;
+	return GetT66CharacterMovement()->HasDoubleJumped();
 }
 
-void ASideScrollingCharacter::SetSoftCollision(bool bEnabled)
+bool ASideScrollingCharacter::HasWallJumped() const
 {
-	// enable or disable collision response to the soft collision channel
-	GetCapsuleComponent()->SetCollisionResponseToChannel(SoftCollisionObjectType, bEnabled ? ECR_Ignore : ECR_Block);
+	return GetT66CharacterMovement()->HasWallJumped();
 }
 
-bool ASideScrollingCharacter::HasDoubleJumped() const
+bool ASideScrollingCharacter::IsWallSliding() const
 {
-	return bHasDoubleJumped;
+	return GetT66CharacterMovement()->IsWallSliding();
 }
 
-bool ASideScrollingCharacter::HasWallJumped() const
+UT66CharacterMovementComponent* ASideScrollingCharacter::GetT66CharacterMovement() const
 {
-	return bHasWallJumped;
+	return CastChecked<UT66CharacterMovementComponent>(GetCharacterMovement());
 }
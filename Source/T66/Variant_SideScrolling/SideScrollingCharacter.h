@@ -9,9 +9,12 @@
 class UCameraComponent;
 class UInputAction;
 struct FInputActionValue;
+class UT66CharacterMovementComponent;
+class UT66GhostRecorderComponent;
 
 /**
  *  A player-controllable character side scrolling game
+ *  Advanced jumps are simulated by UT66CharacterMovementComponent so they can be client predicted
  */
 UCLASS(abstract)
 class ASideScrollingCharacter : public ACharacter
@@ -22,6 +25,10 @@ class ASideScrollingCharacter : public ACharacter
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Camera", meta = (AllowPrivateAccess = "true"))
 	UCameraComponent* Camera;
 
+	/** Records the run for ghost playback */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
+	UT66GhostRecorderComponent* GhostRecorder;
+
 protected:
 
 	/** Move Input Action */
@@ -48,39 +55,11 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Side Scrolling|Interaction")
 	float InteractionRadius = 200.0f;
 
-	/** Time to disable input after a wall jump to preserve momentum */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Wall Jump")
-	float DelayBetweenWallJumps = 0.3f;
-
-	/** Distance to trace ahead of the character for wall jumps */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Wall Jump")
-	float WallJumpTraceDistance = 50.0f;
-
-	/** Horizontal impulse to apply to the character during wall jumps */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Wall Jump")
-	float WallJumpHorizontalImpulse = 500.0f;
-
-	/** Multiplies the jump Z velocity for wall jumps. */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Wall Jump")
-	float WallJumpVerticalMultiplier = 1.4f;
-
-	/** Collision object type to use for soft collision traces (dropping down floors) */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Soft Platforms")
-	TEnumAsByte<ECollisionChannel> SoftCollisionObjectType;
-
-	/** Distance to trace down during soft collision checks */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Soft Platforms")
-	float SoftCollisionTraceDistance = 1000.0f;
-
-	/** Last recorded time when this character started falling */
-	float LastFallTime = 0.0f;
-
-	/** Max amount of time that can pass since we started falling when we allow a regular jump */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Coyote Time", meta = (ClampMin = 0, ClampMax = 5, Units = "s"))
-	float MaxCoyoteTime = 0.16f;
+	/** Interactables within reach, best first. Updated every frame while locally controlled */
+	TArray<TWeakObjectPtr<AActor>> InteractionCandidates;
 
-	/** Wall jump lockout timer */
-	FTimerHandle WallJumpTimer;
+	/** Best interactable within reach */
+	TWeakObjectPtr<AActor> InteractionCandidate;
 
 	/** Last captured horizontal movement input value */
 	float ActionValueY = 0.0f;
@@ -88,36 +67,47 @@ protected:
 	/** Last captured platform drop axis value */
 	float DropValue = 0.0f;
 
-	/** If true, this character has already wall jumped */
-	bool bHasWallJumped = false;
-
-	/** If true, this character has already double jumped */
-	bool bHasDoubleJumped = false;
-
 	/** If true, this character is moving along the side scrolling axis */
 	bool bMovingHorizontally = false;
 
+#if WITH_EDITORONLY_DATA
+	/** Wall jump and coyote settings that moved to UT66CharacterMovementComponent. Loaded only to forward old overrides */
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float DelayBetweenWallJumps_DEPRECATED = 0.3f;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float WallJumpTraceDistance_DEPRECATED = 50.0f;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float WallJumpHorizontalImpulse_DEPRECATED = 500.0f;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float WallJumpVerticalMultiplier_DEPRECATED = 1.4f;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to UT66CharacterMovementComponent."))
+	float MaxCoyoteTime_DEPRECATED = 0.16f;
+#endif
+
 public:
 	
 	/** Constructor */
-	ASideScrollingCharacter();
+	ASideScrollingCharacter(const FObjectInitializer& ObjectInitializer);
 
 protected:
 
-	/** Gameplay cleanup */
-	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
-
 	/** Initialize input action bindings */
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
-	/** Collision handling */
-	virtual void NotifyHit(class UPrimitiveComponent* MyComp, AActor* Other, class UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit) override;
+	/** Updates the interaction candidates */
+	virtual void Tick(float DeltaSeconds) override;
 
-	/** Landing handling */
-	virtual void Landed(const FHitResult& Hit) override;
+#if WITH_EDITORONLY_DATA
+	/** Forwards Blueprint overrides of the deprecated wall jump and coyote settings to the movement component */
+	virtual void PostLoad() override;
+#endif
 
-	/** Handle movement mode changes to keep track of coyote time jumps */
-	virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode = 0) override;
+	/** Collision handling */
+	virtual void NotifyHit(class UPrimitiveComponent* MyComp, AActor* Other, class UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit) override;
 
 protected:
 
@@ -157,16 +147,12 @@ protected:
 	/** Handles advanced jump logic */
 	void MultiJump();
 
-	/** Checks for soft collision with platforms */
-	void CheckForSoftCollision();
+	/** Finds the interactables within reach and picks the best one */
+	void UpdateInteractionCandidates();
 
-	/** Resets wall jump lockout. Called from timer after a wall jump */
-	void ResetWallJump();
-
-public:
-
-	/** Sets the soft collision response. True passes, False blocks */
-	void SetSoftCollision(bool bEnabled);
+	/** Passes control to BP to highlight the best interactable. NewCandidate is null when nothing is in reach */
+	UFUNCTION(BlueprintImplementableEvent, Category="Side Scrolling", meta = (DisplayName = "On Interaction Candidate Changed"))
+	void BP_OnInteractionCandidateChanged(AActor* NewCandidate);
 
 public:
 
@@ -177,4 +163,22 @@ public:
 	/** Returns true if the character has just wall jumped */
 	UFUNCTION(BlueprintPure, Category="Side Scrolling")
 	bool HasWallJumped() const;
+
+	/** Returns true if the character is sliding down a wall */
+	UFUNCTION(BlueprintPure, Category="Side Scrolling")
+	bool IsWallSliding() const;
+
+	/** Returns the best interactable within reach, if any */
+	UFUNCTION(BlueprintPure, Category="Side Scrolling")
+	AActor* GetInteractionCandidate() const { return InteractionCandidate.Get(); }
+
+	/** Returns every interactable within reach, best first */
+	UFUNCTION(BlueprintPure, Category="Side Scrolling")
+	TArray<AActor*> GetInteractionCandidates() const;
+
+	/** Returns the side scrolling movement component */
+	UT66CharacterMovementComponent* GetT66CharacterMovement() const;
+
+	/** Returns the ghost recorder */
+	UT66GhostRecorderComponent* GetGhostRecorder() const { return GhostRecorder; }
 };
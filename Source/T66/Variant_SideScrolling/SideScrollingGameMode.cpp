@@ -6,6 +6,7 @@
 #include "Blueprint/UserWidget.h"
 #include "SideScrollingUI.h"
 #include "SideScrollingPickup.h"
+#include "UI/ViewModels/T66RunHUDSubsystem.h"
 
 void ASideScrollingGameMode::BeginPlay()
 {
@@ -17,19 +18,30 @@ void ASideScrollingGameMode::BeginPlay()
 	UserInterface = CreateWidget<USideScrollingUI>(OwningPlayer, UserInterfaceClass);
 
 	check(UserInterface);
+
+	// add the UI up front. It stays hidden until the first pickup
+	UserInterface->SetVisibility(ESlateVisibility::Collapsed);
+	UserInterface->AddToViewport(0);
 }
 
 void ASideScrollingGameMode::ProcessPickup()
 {
-	// increment the pickups counter
-	++PickupsCollected;
+	ProcessPickups(1);
+}
 
-	// if this is the first pickup we collect, show the UI
-	if (PickupsCollected == 1)
+void ASideScrollingGameMode::ProcessPickups(int32 Count)
+{
+	if (Count <= 0)
 	{
-		UserInterface->AddToViewport(0);
+		return;
 	}
 
-	// update the pickups counter on the UI
-	UserInterface->UpdatePickups(PickupsCollected);
+	// increment the pickups counter
+	PickupsCollected += Count;
+
+	// update the HUD. The UI picks up the change on the next frame
+	if (UT66RunHUDSubsystem* HUD = GetWorld()->GetSubsystem<UT66RunHUDSubsystem>())
+	{
+		HUD->SetPickups(PickupsCollected);
+	}
 }
\ No newline at end of file
@@ -41,4 +41,7 @@ public:
 
 	/** Receives an interaction event from another actor */
 	virtual void ProcessPickup();
+
+	/** Processes a batch of pickups collected on the same frame */
+	virtual void ProcessPickups(int32 Count);
 };
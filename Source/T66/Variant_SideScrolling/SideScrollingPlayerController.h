@@ -9,6 +9,7 @@
 
 class ASideScrollingCharacter;
 class UInputMappingContext;
+struct FInputKeyEventArgs;
 
 /**
  *  A simple Side Scrolling Player Controller
@@ -54,6 +55,9 @@ protected:
 	/** Initialize input bindings */
 	virtual void SetupInputComponent() override;
 
+	/** Timestamps key presses for the input latency instrumentation */
+	virtual bool InputKey(const FInputKeyEventArgs& Params) override;
+
 	/** Pawn initialization */
 	virtual void OnPossess(APawn* InPawn) override;
 
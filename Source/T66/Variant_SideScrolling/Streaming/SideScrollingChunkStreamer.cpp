@@ -0,0 +1,281 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingChunkStreamer.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "TimerManager.h"
+#include "SideScrollingCameraManager.h"
+#include "T66.h"
+
+ASideScrollingChunkStreamer::ASideScrollingChunkStreamer()
+{
+	// streaming runs on a timer. Tick only watches for hitches while chunks stream in
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+}
+
+void ASideScrollingChunkStreamer::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// find the end of the level
+	float LevelEndX = -UE_BIG_NUMBER;
+
+	for (const FSideScrollingLevelChunk& Chunk : Chunks)
+	{
+		LevelEndX = FMath::Max(LevelEndX, Chunk.MaxX);
+	}
+
+	// the soak run ends at the goal, or a little before the end of the last chunk, which the player may never physically reach
+	SoakGoalX = SoakGoal ? SoakGoal->GetActorLocation().X : LevelEndX - SoakGoalMargin;
+
+	ChunkLevels.SetNum(Chunks.Num());
+
+	// the spawn chunks load synchronously on purpose, before any hitches are counted
+	LoadSpawnChunks();
+
+	// start streaming
+	UpdateStreaming();
+	GetWorldTimerManager().SetTimer(UpdateTimer, this, &ASideScrollingChunkStreamer::UpdateStreaming, UpdateInterval, true);
+}
+
+void ASideScrollingChunkStreamer::EndPlay(EEndPlayReason::Type EndPlayReason)
+{
+	GetWorldTimerManager().ClearTimer(UpdateTimer);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASideScrollingChunkStreamer::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// level streaming updates after the actors tick, so a slow last frame with chunks pending means streaming blocked the game thread
+	const float FrameTime = FApp::GetDeltaTime();
+
+	if (bChunksStreamingIn && FrameTime > HitchThreshold)
+	{
+		++NumStreamingHitches;
+
+		UE_LOG(LogT66, Warning, TEXT("Side scrolling chunk streaming hitch: %.1fms frame while chunks were streaming in"), FrameTime * 1000.0f);
+	}
+
+	bChunksStreamingIn = AreChunksStreamingIn();
+
+	// stop watching once everything has streamed in
+	if (!bChunksStreamingIn)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+void ASideScrollingChunkStreamer::UpdateStreaming()
+{
+	float ViewMinX, ViewMaxX, VelocityX;
+
+	if (!GetViewRange(ViewMinX, ViewMaxX, VelocityX))
+	{
+		return;
+	}
+
+	// look further ahead in the direction we're moving
+	const float Prefetch = VelocityX * PrefetchTime;
+
+	const float LoadMinX = ViewMinX - LoadMargin + FMath::Min(0.0f, Prefetch);
+	const float LoadMaxX = ViewMaxX + LoadMargin + FMath::Max(0.0f, Prefetch);
+
+	// never unload closer than we load, or chunks at the edge would load and unload every update
+	const float KeepMargin = FMath::Max(UnloadMargin, LoadMargin);
+
+	const float KeepMinX = ViewMinX - KeepMargin + FMath::Min(0.0f, Prefetch);
+	const float KeepMaxX = ViewMaxX + KeepMargin + FMath::Max(0.0f, Prefetch);
+
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		const FSideScrollingLevelChunk& Chunk = Chunks[ChunkIndex];
+
+		// load chunks close to the view, and only unload them once they're well out of it
+		if (Chunk.MaxX >= LoadMinX && Chunk.MinX <= LoadMaxX)
+		{
+			SetChunkLoaded(ChunkIndex, true);
+
+		} else if (Chunk.MaxX < KeepMinX || Chunk.MinX > KeepMaxX) {
+
+			SetChunkLoaded(ChunkIndex, false);
+		}
+	}
+}
+
+bool ASideScrollingChunkStreamer::GetViewRange(float& OutMinX, float& OutMaxX, float& OutVelocityX) const
+{
+	const APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+	const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+
+	if (!Pawn)
+	{
+		return false;
+	}
+
+	const FVector PawnLocation = Pawn->GetActorLocation();
+	OutVelocityX = Pawn->GetVelocity().X;
+
+	// work out how much of the play plane the camera sees
+	float HalfWidth = 0.0f;
+	float CenterX = PawnLocation.X;
+
+	if (const APlayerCameraManager* Camera = PC->PlayerCameraManager)
+	{
+		const FVector CameraLocation = Camera->GetCameraLocation();
+		const float Distance = FMath::Abs(CameraLocation.Y - PawnLocation.Y);
+
+		CenterX = CameraLocation.X;
+		HalfWidth = Distance * FMath::Tan(FMath::DegreesToRadians(Camera->GetFOVAngle() * 0.5f));
+	}
+
+	OutMinX = CenterX - HalfWidth;
+	OutMaxX = CenterX + HalfWidth;
+
+	return true;
+}
+
+void ASideScrollingChunkStreamer::LoadSpawnChunks()
+{
+	// find where the player starts. The pawn is usually spawned before BeginPlay, otherwise use the player start
+	float SpawnX = 0.0f;
+
+	if (const APawn* Pawn = GetPlayerPawn())
+	{
+		SpawnX = Pawn->GetActorLocation().X;
+
+	} else {
+
+		TActorIterator<APlayerStart> PlayerStart(GetWorld());
+
+		if (!PlayerStart)
+		{
+			return;
+		}
+
+		SpawnX = PlayerStart->GetActorLocation().X;
+	}
+
+	// request every chunk under the spawn point as a blocking load
+	bool bAnyRequested = false;
+
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		if (Chunks[ChunkIndex].MinX <= SpawnX && Chunks[ChunkIndex].MaxX >= SpawnX)
+		{
+			SetChunkLoaded(ChunkIndex, true, true);
+			bAnyRequested = true;
+		}
+	}
+
+	if (!bAnyRequested)
+	{
+		return;
+	}
+
+	// load and show them right away
+	GetWorld()->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+
+	// if they're unloaded later, they stream back in asynchronously like any other chunk
+	for (ULevelStreamingDynamic* ChunkLevel : ChunkLevels)
+	{
+		if (ChunkLevel)
+		{
+			ChunkLevel->bShouldBlockOnLoad = false;
+		}
+	}
+}
+
+void ASideScrollingChunkStreamer::SetChunkLoaded(int32 ChunkIndex, bool bLoaded, bool bBlockOnLoad)
+{
+	ULevelStreamingDynamic* ChunkLevel = ChunkLevels[ChunkIndex];
+
+	if (!ChunkLevel)
+	{
+		// nothing to unload
+		if (!bLoaded)
+		{
+			return;
+		}
+
+		const FSideScrollingLevelChunk& Chunk = Chunks[ChunkIndex];
+
+		if (Chunk.Level.IsNull())
+		{
+			return;
+		}
+
+		// create the streaming level. It loads asynchronously unless it blocks
+		bool bSuccess = false;
+		ChunkLevel = ULevelStreamingDynamic::LoadLevelInstanceBySoftObjectPtr(this, Chunk.Level, Chunk.Offset, FRotator::ZeroRotator, bSuccess);
+
+		if (!bSuccess || !ChunkLevel)
+		{
+			UE_LOG(LogT66, Warning, TEXT("Could not stream in side scrolling chunk %s"), *Chunk.Level.ToString());
+			return;
+		}
+
+		ChunkLevel->bShouldBlockOnLoad = bBlockOnLoad;
+		ChunkLevel->OnLevelShown.AddDynamic(this, &ASideScrollingChunkStreamer::OnChunkVisibilityChanged);
+		ChunkLevel->OnLevelHidden.AddDynamic(this, &ASideScrollingChunkStreamer::OnChunkVisibilityChanged);
+
+		ChunkLevels[ChunkIndex] = ChunkLevel;
+
+		// watch for hitches until it has streamed in
+		SetActorTickEnabled(true);
+		return;
+	}
+
+	// toggle the existing streaming level
+	if (ChunkLevel->ShouldBeLoaded() != bLoaded)
+	{
+		ChunkLevel->bShouldBlockOnLoad = bBlockOnLoad;
+		ChunkLevel->SetShouldBeLoaded(bLoaded);
+		ChunkLevel->SetShouldBeVisible(bLoaded);
+
+		if (bLoaded)
+		{
+			SetActorTickEnabled(true);
+		}
+	}
+}
+
+bool ASideScrollingChunkStreamer::AreChunksStreamingIn() const
+{
+	for (const ULevelStreamingDynamic* ChunkLevel : ChunkLevels)
+	{
+		if (ChunkLevel && ChunkLevel->GetShouldBeVisibleFlag() && !ChunkLevel->IsLevelVisible())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ASideScrollingChunkStreamer::OnChunkVisibilityChanged()
+{
+	// let the camera pick up the chunk's height fields and camera volumes
+	if (const APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
+	{
+		if (ASideScrollingCameraManager* Camera = Cast<ASideScrollingCameraManager>(PC->PlayerCameraManager))
+		{
+			Camera->RefreshLevelData();
+		}
+	}
+}
+
+APawn* ASideScrollingChunkStreamer::GetPlayerPawn() const
+{
+	return UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+}
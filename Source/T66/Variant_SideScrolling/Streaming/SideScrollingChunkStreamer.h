@@ -0,0 +1,158 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SideScrollingChunkStreamer.generated.h"
+
+class ULevelStreamingDynamic;
+class APawn;
+
+/**
+ *  A stretch of a side scrolling level along X, stored in its own level
+ */
+USTRUCT(BlueprintType)
+struct FSideScrollingLevelChunk
+{
+	GENERATED_BODY()
+
+	/** Level holding the chunk's actors */
+	UPROPERTY(EditAnywhere, Category="Chunk")
+	TSoftObjectPtr<UWorld> Level;
+
+	/** Start of the chunk along X */
+	UPROPERTY(EditAnywhere, Category="Chunk", meta = (Units="cm"))
+	float MinX = 0.0f;
+
+	/** End of the chunk along X */
+	UPROPERTY(EditAnywhere, Category="Chunk", meta = (Units="cm"))
+	float MaxX = 0.0f;
+
+	/** Offset the level is loaded at */
+	UPROPERTY(EditAnywhere, Category="Chunk")
+	FVector Offset = FVector::ZeroVector;
+};
+
+/**
+ *  Streams a side scrolling level in chunks along the X axis.
+ *  Place one in the persistent level and list the chunk levels. Chunks are loaded asynchronously
+ *  when they get close to the camera's view, looking further ahead the faster the player moves,
+ *  and are unloaded once they're well behind the view. The unload distance is larger than the load distance
+ *  so chunks near the edge don't load and unload repeatedly. The chunks under the spawn point are loaded before play starts.
+ *  Frames over the hitch threshold while chunks stream in are counted; the T66.SideScrolling.Streaming.Soak automation test
+ *  runs the player across the level and fails if there are any.
+ */
+UCLASS()
+class ASideScrollingChunkStreamer : public AActor
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Level chunks */
+	UPROPERTY(EditAnywhere, Category="Streaming")
+	TArray<FSideScrollingLevelChunk> Chunks;
+
+	/** Time between streaming updates */
+	UPROPERTY(EditAnywhere, Category="Streaming", meta = (ClampMin = 0.01, ClampMax = 2, Units="s"))
+	float UpdateInterval = 0.1f;
+
+	/** Extra distance beyond the camera's view where chunks are loaded */
+	UPROPERTY(EditAnywhere, Category="Streaming", meta = (ClampMin = 0, ClampMax = 100000, Units="cm"))
+	float LoadMargin = 2000.0f;
+
+	/** Extra distance beyond the camera's view where chunks are unloaded. Never less than the load margin */
+	UPROPERTY(EditAnywhere, Category="Streaming", meta = (ClampMin = 0, ClampMax = 100000, Units="cm"))
+	float UnloadMargin = 4000.0f;
+
+	/** How far ahead to prefetch, as time at the player's current horizontal speed */
+	UPROPERTY(EditAnywhere, Category="Streaming", meta = (ClampMin = 0, ClampMax = 10, Units="s"))
+	float PrefetchTime = 1.5f;
+
+	/** Frames longer than this while chunks are streaming in count as streaming hitches */
+	UPROPERTY(EditAnywhere, Category="Streaming", meta = (ClampMin = 0.005, ClampMax = 1, Units="s"))
+	float HitchThreshold = 0.05f;
+
+	/** Max time the soak run can take before it fails */
+	UPROPERTY(EditAnywhere, Category="Streaming|Soak", meta = (ClampMin = 1, ClampMax = 3600, Units="s"))
+	float SoakTimeout = 300.0f;
+
+	/** Time without progress before the soak run jumps to get over obstacles */
+	UPROPERTY(EditAnywhere, Category="Streaming|Soak", meta = (ClampMin = 0.1, ClampMax = 10, Units="s"))
+	float SoakStuckTime = 0.5f;
+
+	/** Actor marking the end of the level, usually the finish trigger. The soak run passes once the player reaches its X */
+	UPROPERTY(EditInstanceOnly, Category="Streaming|Soak")
+	TObjectPtr<AActor> SoakGoal;
+
+	/** Without a soak goal, the soak run passes this far before the end of the last chunk */
+	UPROPERTY(EditAnywhere, Category="Streaming|Soak", meta = (ClampMin = 0, ClampMax = 100000, Units="cm"))
+	float SoakGoalMargin = 500.0f;
+
+	/** Streaming level for each chunk, created the first time it's loaded */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ULevelStreamingDynamic>> ChunkLevels;
+
+	/** X the soak run has to reach */
+	float SoakGoalX = 0.0f;
+
+	/** Streaming update timer */
+	FTimerHandle UpdateTimer;
+
+	/** Number of hitches while chunks were streaming in, since the spawn chunks were loaded */
+	int32 NumStreamingHitches = 0;
+
+	/** True if chunks were still streaming in on the last tick */
+	bool bChunksStreamingIn = false;
+
+public:
+
+	/** Constructor */
+	ASideScrollingChunkStreamer();
+
+	/** Returns the number of hitches while chunks were streaming in, since the spawn chunks were loaded */
+	int32 GetNumStreamingHitches() const { return NumStreamingHitches; }
+
+	/** Returns the X the soak run has to reach */
+	float GetSoakGoalX() const { return SoakGoalX; }
+
+	/** Returns the max time the soak run can take */
+	float GetSoakTimeout() const { return SoakTimeout; }
+
+	/** Returns the time without progress before the soak run jumps */
+	float GetSoakStuckTime() const { return SoakStuckTime; }
+
+protected:
+
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
+	/** Gameplay cleanup */
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+	/** Counts hitches while chunks are streaming in */
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** Loads and unloads chunks around the camera */
+	void UpdateStreaming();
+
+	/** Computes the X range the camera can see. Returns false if there's no player to stream around */
+	bool GetViewRange(float& OutMinX, float& OutMaxX, float& OutVelocityX) const;
+
+	/** Requests a chunk to be loaded or unloaded. A blocking load completes on the next level streaming flush */
+	void SetChunkLoaded(int32 ChunkIndex, bool bLoaded, bool bBlockOnLoad = false);
+
+	/** Returns true if any requested chunk isn't visible yet */
+	bool AreChunksStreamingIn() const;
+
+	/** Loads the chunks under the player's spawn point before play starts so the player doesn't fall through the floor */
+	void LoadSpawnChunks();
+
+	/** Refreshes the camera's level data when a chunk is shown or hidden */
+	UFUNCTION()
+	void OnChunkVisibilityChanged();
+
+	/** Returns the player pawn */
+	APawn* GetPlayerPawn() const;
+};
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingChunkStreamer.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Character.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/PackageName.h"
+#include "Tests/AutomationCommon.h"
+#include "T66RunTimerSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SideScrollingStreamingSoakTest
+{
+	/** Game config section listing the maps to soak, as +Maps=/Game/Path/Map */
+	const TCHAR* ConfigSection = TEXT("T66.StreamingSoak");
+}
+
+/**
+ *  Runs the player to the end of the level, jumping over whatever holds it back,
+ *  and fails if the chunk streamer saw a hitch while chunks were streaming in
+ */
+class FSideScrollingStreamingSoakCommand : public IAutomationLatentCommand
+{
+public:
+
+	FSideScrollingStreamingSoakCommand(FAutomationTestBase* InTest)
+		: Test(InTest)
+	{
+	}
+
+	virtual bool Update() override
+	{
+		UWorld* World = AutomationCommon::GetAnyGameWorld();
+
+		if (!World)
+		{
+			Test->AddError(TEXT("No game world to soak"));
+			return true;
+		}
+
+		TActorIterator<ASideScrollingChunkStreamer> Streamer(World);
+
+		if (!Streamer)
+		{
+			Test->AddError(FString::Printf(TEXT("%s has no chunk streamer"), *World->GetMapName()));
+			return true;
+		}
+
+		// wait for the player to spawn
+		ACharacter* Character = Cast<ACharacter>(UGameplayStatics::GetPlayerPawn(World, 0));
+
+		if (!Character)
+		{
+			return false;
+		}
+
+		const double Now = World->GetTimeSeconds();
+
+		if (SoakStartTime < 0.0)
+		{
+			SoakStartTime = Now;
+			LastProgressTime = Now;
+		}
+
+		// have we crossed the whole level? The level's finish trigger ending the run counts too
+		const float PawnX = Character->GetActorLocation().X;
+
+		const UT66RunTimerSubsystem* RunTimer = World->GetSubsystem<UT66RunTimerSubsystem>();
+		const bool bRunFinished = RunTimer && RunTimer->GetState() == ET66RunTimerState::Finished;
+
+		if (PawnX >= Streamer->GetSoakGoalX() || bRunFinished)
+		{
+			Test->TestEqual(TEXT("Streaming hitches"), Streamer->GetNumStreamingHitches(), 0);
+			Test->AddInfo(FString::Printf(TEXT("Reached the end in %.1fs"), Now - SoakStartTime));
+			return true;
+		}
+
+		if (Now - SoakStartTime >= Streamer->GetSoakTimeout())
+		{
+			Test->AddError(FString::Printf(TEXT("Timed out at X %.0f of %.0f with %d streaming hitch(es)"), PawnX, Streamer->GetSoakGoalX(), Streamer->GetNumStreamingHitches()));
+			return true;
+		}
+
+		// keep moving right
+		Character->AddMovementInput(FVector::ForwardVector, 1.0f);
+
+		// jump over whatever is holding us back
+		if (PawnX > BestX + 1.0f)
+		{
+			BestX = PawnX;
+			LastProgressTime = Now;
+
+		} else if (Now - LastProgressTime >= Streamer->GetSoakStuckTime()) {
+
+			LastProgressTime = Now;
+			Character->Jump();
+		}
+
+		return false;
+	}
+
+private:
+
+	FAutomationTestBase* Test;
+
+	/** Soak run progress, in world time */
+	double SoakStartTime = -1.0;
+	double LastProgressTime = 0.0;
+	float BestX = -UE_BIG_NUMBER;
+};
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FSideScrollingStreamingSoakTest, "T66.SideScrolling.Streaming.Soak", EAutomationTestFlags::ClientContext | EAutomationTestFlags::StressFilter)
+
+void FSideScrollingStreamingSoakTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	TArray<FString> Maps;
+	GConfig->GetArray(SideScrollingStreamingSoakTest::ConfigSection, TEXT("Maps"), Maps, GGameIni);
+
+	for (const FString& Map : Maps)
+	{
+		OutBeautifiedNames.Add(FPackageName::GetShortName(Map));
+		OutTestCommands.Add(Map);
+	}
+}
+
+bool FSideScrollingStreamingSoakTest::RunTest(const FString& Parameters)
+{
+	// the soak needs a game world, so it runs in -game sessions
+	if (!AutomationOpenMap(Parameters))
+	{
+		AddError(FString::Printf(TEXT("Could not open %s"), *Parameters));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FSideScrollingStreamingSoakCommand(this));
+
+	return true;
+}
+
+#endif
@@ -2,4 +2,48 @@
 
 
 #include "SideScrollingUI.h"
+#include "Engine/World.h"
+#include "UI/ViewModels/T66RunHUDSubsystem.h"
+#include "UI/ViewModels/T66RunHUDViewModel.h"
 
+void USideScrollingUI::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	// find the run HUD viewmodel
+	if (UT66RunHUDSubsystem* HUD = GetWorld()->GetSubsystem<UT66RunHUDSubsystem>())
+	{
+		ViewModel = HUD->GetViewModel();
+	}
+
+	if (!ViewModel)
+	{
+		return;
+	}
+
+	// the viewmodel only notifies on changes, already coalesced per frame
+	ViewModel->AddFieldValueChangedDelegate(UT66RunHUDViewModel::FFieldNotificationClassDescriptor::Pickups,
+		UT66RunHUDViewModel::FFieldValueChangedDelegate::CreateUObject(this, &USideScrollingUI::OnPickupsChanged));
+
+	// sync with the current value
+	OnPickupsChanged(ViewModel, UT66RunHUDViewModel::FFieldNotificationClassDescriptor::Pickups);
+}
+
+void USideScrollingUI::NativeDestruct()
+{
+	if (ViewModel)
+	{
+		ViewModel->RemoveAllFieldValueChangedDelegates(this);
+		ViewModel = nullptr;
+	}
+
+	Super::NativeDestruct();
+}
+
+void USideScrollingUI::OnPickupsChanged(UObject* InViewModel, UE::FieldNotification::FFieldId FieldId)
+{
+	// show the counter once there's something to count
+	SetVisibility(ViewModel->GetPickupsVisibility());
+
+	UpdatePickups(ViewModel->GetPickups());
+}
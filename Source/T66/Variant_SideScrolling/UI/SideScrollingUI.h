@@ -4,20 +4,44 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "FieldNotificationId.h"
 #include "SideScrollingUI.generated.h"
 
+class UT66RunHUDViewModel;
+
 /**
  *  Simple Side Scrolling game UI
  *  Displays and manages a pickup counter
+ *  Values come from the RunHUD viewmodel. Widget bindings can use it directly,
+ *  and the pickup counter stays hidden until the first pickup
  */
 UCLASS(abstract)
 class USideScrollingUI : public UUserWidget
 {
 	GENERATED_BODY()
-	
+
+	/** Run HUD viewmodel we're bound to */
+	UPROPERTY(Transient)
+	TObjectPtr<UT66RunHUDViewModel> ViewModel;
+
 public:
 
-	/** Update the widget's pickup counter */
+	/** Update the widget's pickup counter. Called only when the count changes */
 	UFUNCTION(BlueprintImplementableEvent, Category="UI")
 	void UpdatePickups(int32 Amount);
+
+	/** Returns the run HUD viewmodel */
+	UFUNCTION(BlueprintPure, Category="UI")
+	UT66RunHUDViewModel* GetViewModel() const { return ViewModel; }
+
+protected:
+
+	/** Binds to the run HUD viewmodel */
+	virtual void NativeConstruct() override;
+
+	/** Unbinds from the run HUD viewmodel */
+	virtual void NativeDestruct() override;
+
+	/** Handles pickup count changes */
+	void OnPickupsChanged(UObject* InViewModel, UE::FieldNotification::FFieldId FieldId);
 };
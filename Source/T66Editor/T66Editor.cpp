@@ -2,6 +2,7 @@
 #include "ToolMenus.h"
 #include "Editor.h"
 
+#include "T66LevelTools.h"
 #include "T66RegistryTools.h"
 #include "T66WidgetTools.h"
 
@@ -45,6 +46,12 @@ private:
 				return GEditor->GetEditorSubsystem<UT66WidgetTools>();
 			};
 
+		auto GetLevelTools = []() -> UT66LevelTools*
+			{
+				if (!GEditor) return nullptr;
+				return GEditor->GetEditorSubsystem<UT66LevelTools>();
+			};
+
 		// 1) Fill Surface Registry
 		{
 			FToolUIActionChoice Action(FExecuteAction::CreateLambda([GetRegistryToolsSubsystem]()
@@ -158,6 +165,25 @@ private:
 				Action
 			));
 		}
+
+		// 7) Bake Side Scrolling Camera Height Fields
+		{
+			FToolUIActionChoice Action(FExecuteAction::CreateLambda([GetLevelTools]()
+				{
+					if (UT66LevelTools* Tools = GetLevelTools())
+					{
+						Tools->BakeSideScrollingCameraHeightFields();
+					}
+				}));
+
+			Section.AddEntry(FToolMenuEntry::InitMenuEntry(
+				FName("T66Tools_BakeSideScrollingCameraHeightFields"),
+				FText::FromString("T66 Tools: Bake Side Scrolling Camera Height Fields"),
+				FText::FromString("Samples walkable ground into every camera height field in the open level."),
+				FSlateIcon(),
+				Action
+			));
+		}
 	}
 };
 
@@ -0,0 +1,37 @@
+﻿#include "T66LevelTools.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "ScopedTransaction.h"
+
+// ✅ Runtime level actor types
+#include "SideScrollingCameraHeightField.h"
+
+void UT66LevelTools::BakeSideScrollingCameraHeightFields()
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[T66LevelTools] No editor world to bake."));
+		return;
+	}
+
+	// ✅ One undo step for the whole bake
+	const FScopedTransaction Transaction(FText::FromString("Bake Side Scrolling Camera Height Fields"));
+
+	int32 NumBaked = 0;
+
+	for (TActorIterator<ASideScrollingCameraHeightField> It(World); It; ++It)
+	{
+		It->Bake();
+		It->MarkPackageDirty();
+		++NumBaked;
+	}
+
+	if (NumBaked == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[T66LevelTools] No ASideScrollingCameraHeightField actors in %s."), *World->GetMapName());
+		return;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[T66LevelTools] Baked %d camera height field(s). Save the level to keep the data."), NumBaked);
+}
@@ -0,0 +1,16 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "T66LevelTools.generated.h"
+
+UCLASS()
+class T66EDITOR_API UT66LevelTools : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ✅ Bakes every ASideScrollingCameraHeightField in the current editor level
+	UFUNCTION(CallInEditor, Category = "T66|LevelTools")
+	void BakeSideScrollingCameraHeightFields();
+};
@@ -488,6 +488,15 @@ void UT66RegistryTools::CreateOrRepairUIThemeAssets()
 			}
 		};
 
+	// ✅ Sound groups decide which (soft) sound tokens stream in together at runtime
+	auto EnsureSoundGroup = [](UT66UIThemeDA* Theme, const FName GroupName, const TArray<FName>& Tokens)
+		{
+			if (Theme && !Theme->SoundGroups.Contains(GroupName))
+			{
+				Theme->SoundGroups.Add(GroupName).Tokens = Tokens;
+			}
+		};
+
 	for (const FString& AssetName : RequiredAssetNames)
 	{
 		// Canonical package/object path
@@ -589,6 +598,13 @@ void UT66RegistryTools::CreateOrRepairUIThemeAssets()
 		EnsureVector2(ThemeDA, FName(TEXT("Icon.Size.S")), FVector2D(24.f, 24.f));
 		EnsureVector2(ThemeDA, FName(TEXT("Button.MinSize")), FVector2D(260.f, 48.f));
 
+		// Starter sound groups live on the audio theme (frontend = menus, in-run = HUD)
+		if (AssetName == TEXT("DA_UITheme_Audio"))
+		{
+			EnsureSoundGroup(ThemeDA, FName(TEXT("Frontend")), { FName(TEXT("SFX.UI.Hover")), FName(TEXT("SFX.UI.Click")), FName(TEXT("SFX.UI.Back")) });
+			EnsureSoundGroup(ThemeDA, FName(TEXT("InRun")), { FName(TEXT("SFX.UI.Hover")), FName(TEXT("SFX.UI.Click")) });
+		}
+
 		ThemeDA->MarkPackageDirty();
 
 		const bool bSaved = UEditorAssetLibrary::SaveLoadedAsset(ThemeDA, /*bOnlyIfIsDirty=*/true);
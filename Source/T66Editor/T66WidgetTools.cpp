@@ -35,6 +35,10 @@
 #include "Components/Border.h"
 #include "Components/SizeBox.h"
 #include "Components/PanelWidget.h"
+#include "Components/ListView.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "UI/Widgets/T66ListScreenWidgetBase.h"
+#include "UI/Lists/T66ListProvider.h"
 
 namespace T66WidgetLayoutRecipes
 {
@@ -284,6 +288,10 @@ TEXT("/Game/Tribulation66/Content/UI/Components/Button/WBP_Comp_Button_Action.WB
 static const TCHAR* T66_ICON_BUTTON_CLASS_PATH =
 TEXT("/Game/Tribulation66/Content/UI/Components/Button/WBP_Comp_Button_IconOnly.WBP_Comp_Button_IconOnly_C");
 
+// ✅ List view entry (rows are recycled, not built per item)
+static const TCHAR* T66_LIST_ROW_CLASS_PATH =
+TEXT("/Game/Tribulation66/Content/UI/Components/UI_Blocks/WBP_Comp_ListRow.WBP_Comp_ListRow_C");
+
 
 namespace T66WidgetLayoutRecipes_Internal
 {
@@ -998,6 +1006,133 @@ namespace T66WidgetLayoutRecipes_Internal
 		return true;
 	}
 
+	// ------------------------------------------------------------
+	// Virtualized list helper (ListView_Items + WBP_Comp_ListRow entries)
+	// ------------------------------------------------------------
+
+	static UListView* EnsureListView(UWidgetBlueprint* BP, UVerticalBox* VB, const FName ListName)
+	{
+		if (!BP || !BP->WidgetTree || !VB)
+		{
+			return nullptr;
+		}
+
+		if (UWidget* Existing = BP->WidgetTree->FindWidget(ListName))
+		{
+			return Cast<UListView>(Existing);
+		}
+
+		UListView* List = BP->WidgetTree->ConstructWidget<UListView>(UListView::StaticClass(), ListName);
+		if (!List)
+		{
+			return nullptr;
+		}
+
+		VB->AddChildToVerticalBox(List);
+
+		if (UVerticalBoxSlot* Slot = Cast<UVerticalBoxSlot>(List->Slot))
+		{
+			Slot->SetSize(FSlateChildSize(ESlateSizeRule::Fill));
+		}
+
+		// EntryWidgetClass is protected on UListViewBase: set it through reflection
+		UClass* EntryClass = StaticLoadClass(UUserWidget::StaticClass(), nullptr, T66_LIST_ROW_CLASS_PATH);
+		if (!EntryClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[T66WidgetLayoutRecipes] Failed to load list row class: %s"), T66_LIST_ROW_CLASS_PATH);
+		}
+		else if (!EntryClass->ImplementsInterface(UUserObjectListEntry::StaticClass()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[T66WidgetLayoutRecipes] %s isn't a list entry. Reparent it to UT66ListEntryWidgetBase, then set %s's EntryWidgetClass."),
+				*EntryClass->GetName(), *ListName.ToString());
+		}
+		else if (FClassProperty* EntryClassProp = FindFProperty<FClassProperty>(UListViewBase::StaticClass(), TEXT("EntryWidgetClass")))
+		{
+			EntryClassProp->SetObjectPropertyValue_InContainer(List, EntryClass);
+		}
+
+		return List;
+	}
+
+	// Instanced provider on the list screen CDO (Provider is protected: set it through reflection)
+	static bool TrySetListProvider_IfEmpty(UWidgetBlueprint* BP, UClass* ProviderClass)
+	{
+		UObject* CDO = (BP && BP->GeneratedClass) ? BP->GeneratedClass->GetDefaultObject() : nullptr;
+		if (!CDO || !ProviderClass)
+		{
+			return false;
+		}
+
+		FObjectProperty* ProviderProp = FindFProperty<FObjectProperty>(CDO->GetClass(), TEXT("Provider"));
+		if (!ProviderProp || ProviderProp->GetObjectPropertyValue_InContainer(CDO))
+		{
+			return false; // Not a list screen yet, or already has a provider (add/repair only)
+		}
+
+		UObject* Provider = NewObject<UT66ListProvider>(CDO, ProviderClass, NAME_None, RF_Public | RF_ArchetypeObject | RF_Transactional);
+		ProviderProp->SetObjectPropertyValue_InContainer(CDO, Provider);
+		return true;
+	}
+
+	// Migrates a list screen to UT66ListScreenWidgetBase + ListView_Items (+ a native provider, if there is one).
+	// Existing layouts from older recipes keep their VB: the placeholder row button is replaced by the list in place.
+	static UListView* EnsureListScreen(UWidgetBlueprint* BP, UVerticalBox* VB, const FName PlaceholderName, const FName ListName, UClass* ProviderClass = nullptr)
+	{
+		if (!BP || !BP->WidgetTree || !VB)
+		{
+			return nullptr;
+		}
+
+		// Reparent only from a base of UT66ListScreenWidgetBase (ex: UT66ScreenWidgetBase), so nothing the old parent did is lost
+		if (BP->ParentClass && !BP->ParentClass->IsChildOf(UT66ListScreenWidgetBase::StaticClass()))
+		{
+			if (UT66ListScreenWidgetBase::StaticClass()->IsChildOf(BP->ParentClass))
+			{
+				UE_LOG(LogTemp, Display, TEXT("[T66WidgetLayoutRecipes] Reparenting %s from %s to UT66ListScreenWidgetBase."),
+					*BP->GetName(), *BP->ParentClass->GetName());
+
+				BP->ParentClass = UT66ListScreenWidgetBase::StaticClass();
+				FBlueprintEditorUtils::RefreshAllNodes(BP);
+				FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(BP);
+
+				// Compile now so the generated class (and its CDO) has the list screen properties recipes set below
+				UBlueprintEditorLibrary::CompileBlueprint(BP);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[T66WidgetLayoutRecipes] %s derives from %s, not a base of UT66ListScreenWidgetBase. Reparent it by hand so %s gets its rows."),
+					*BP->GetName(), *BP->ParentClass->GetName(), *ListName.ToString());
+			}
+		}
+
+		// Remember where the placeholder row was, then drop it (graphs still using it will fail to compile and say so)
+		int32 PlaceholderIndex = INDEX_NONE;
+
+		if (UWidget* Placeholder = BP->WidgetTree->FindWidget(PlaceholderName))
+		{
+			if (Placeholder->GetParent() == VB)
+			{
+				PlaceholderIndex = VB->GetChildIndex(Placeholder);
+			}
+
+			UE_LOG(LogTemp, Display, TEXT("[T66WidgetLayoutRecipes] Replacing placeholder %s in %s with %s."),
+				*PlaceholderName.ToString(), *BP->GetName(), *ListName.ToString());
+
+			BP->WidgetTree->RemoveWidget(Placeholder);
+		}
+
+		UListView* List = EnsureListView(BP, VB, ListName);
+
+		if (List && PlaceholderIndex != INDEX_NONE && List->GetParent() == VB)
+		{
+			VB->ShiftChild(PlaceholderIndex, List);
+		}
+
+		TrySetListProvider_IfEmpty(BP, ProviderClass);
+
+		return List;
+	}
+
 	// ------------------------------------------------------------
 	// Recipe: Generic List Screen helper
 	// ------------------------------------------------------------
@@ -1005,9 +1140,8 @@ namespace T66WidgetLayoutRecipes_Internal
 	static bool ApplySimpleListScreen(
 		UWidgetBlueprint* BP,
 		const FString& ExpectedName,
-		const FName EntryName,
-		const FText& EntryLabel,
-		const FGameplayTag& EntryFocusTag,
+		const FName PlaceholderName,
+		const FName ListName,
 		const FName BackButtonName,
 		const FGameplayTag& BackRoute)
 	{
@@ -1038,7 +1172,7 @@ namespace T66WidgetLayoutRecipes_Internal
 			return false;
 		}
 
-		EnsureActionButton(BP, VB, ActionButtonClass, EntryName, EntryLabel, EntryFocusTag, FGameplayTag(), FGameplayTag());
+		EnsureListScreen(BP, VB, PlaceholderName, ListName);
 		EnsureActionButton(BP, VB, ActionButtonClass, BackButtonName, FText::FromString(TEXT("Back")), FGameplayTag(), SafeTag(TEXT("UI.Action.Back")), BackRoute);
 
 		return true;
@@ -1255,20 +1389,20 @@ namespace T66WidgetLayoutRecipes_Internal
 			return false;
 		}
 
-		const FGameplayTag FocusList = SafeTag(TEXT("Focus.List"));
-		const FGameplayTag ActionConfirm = SafeTag(TEXT("UI.Action.Confirm"));
 		const FGameplayTag ActionDelete = SafeTag(TEXT("UI.Action.Delete"));
 		const FGameplayTag ActionBack = SafeTag(TEXT("UI.Action.Back"));
 
-		const FGameplayTag Route_SavePreview = SafeTag(TEXT("UI.Screen.SavePreview"));
 		const FGameplayTag Route_MainMenu = SafeTag(TEXT("UI.Screen.MainMenu"));
 		const FGameplayTag Route_DeleteConfirm = SafeTag(TEXT("UI.Modal.DeleteSaveConfirm"));
 
-		EnsureActionButton(BP, VB, ActionButtonClass, FName(TEXT("Button_Slot_0")),
-			FText::FromString(TEXT("Slot 1")),
-			FocusList,
-			ActionConfirm,
-			Route_SavePreview);
+		// Slots are rows of a virtualized list (UT66SaveSlotsListProvider); Delete acts on the selected row
+		EnsureListScreen(BP, VB, FName(TEXT("Button_Slot_0")), FName(TEXT("ListView_Items")), UT66SaveSlotsListProvider::StaticClass());
+
+		// A clicked slot opens its preview (UT66ListScreenWidgetBase::RowRouteTag, a class default)
+		if (BP->GeneratedClass)
+		{
+			TrySetGameplayTagProperty_IfEmpty(BP->GeneratedClass->GetDefaultObject(), FName(TEXT("RowRouteTag")), SafeTag(TEXT("UI.Screen.SavePreview")));
+		}
 
 		EnsureActionButton(BP, VB, ActionButtonClass, FName(TEXT("Button_Delete")),
 			FText::FromString(TEXT("Delete")),
@@ -1538,8 +1672,7 @@ namespace T66WidgetLayoutRecipes_Internal
 			BP,
 			TEXT("WBP_Screen_Achievements"),
 			FName(TEXT("Button_Achievement_0")),
-			FText::FromString(TEXT("Achievement 1")),
-			SafeTag(TEXT("Focus.List")),
+			FName(TEXT("ListView_Items")),
 			FName(TEXT("Button_Back")),
 			SafeTag(TEXT("UI.Screen.MainMenu"))
 		);
@@ -1686,18 +1819,14 @@ namespace T66WidgetLayoutRecipes_Internal
 			return false;
 		}
 
-		const FGameplayTag FocusList = SafeTag(TEXT("Focus.List"));
 		const FGameplayTag ActionReportRun = SafeTag(TEXT("UI.Action.ReportRun"));
 		const FGameplayTag ActionBack = SafeTag(TEXT("UI.Action.Back"));
 
 		const FGameplayTag Route_ReportRun = SafeTag(TEXT("UI.Modal.ReportRun"));
 		const FGameplayTag Route_MainMenu = SafeTag(TEXT("UI.Screen.MainMenu"));
 
-		EnsureActionButton(BP, VB, ActionButtonClass, FName(TEXT("Button_TimelineEvent_0")),
-			FText::FromString(TEXT("Event 1")),
-			FocusList,
-			FGameplayTag(),
-			FGameplayTag());
+		// Timeline events are rows of a virtualized list (UT66RunSplitsListProvider)
+		EnsureListScreen(BP, VB, FName(TEXT("Button_TimelineEvent_0")), FName(TEXT("ListView_Items")), UT66RunSplitsListProvider::StaticClass());
 
 		EnsureActionButton(BP, VB, ActionButtonClass, FName(TEXT("Button_ReportRun")),
 			FText::FromString(TEXT("Report Run")),